@@ -164,6 +164,14 @@
  *  - uint64_t
  *  - float32_t
  *  - float64_t
+ *  - TypedArrays of any element type except Uint8ClampedArray, passed as
+ *    const FastApiTypedArray<T>&
+ *  - flat sequential one-byte and two-byte strings, passed as
+ *    const FastOneByteString& and const FastTwoByteString&
+ *
+ * Results that don't fit the supported return types can be written into a
+ * TypedArray argument, which the callback receives as a view on the
+ * TypedArray's backing store.
  *
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
@@ -177,7 +185,7 @@
  * passes NaN values as-is, i.e. doesn't normalize them.
  *
  * To be supported types:
- *  - TypedArrays and ArrayBuffers
+ *  - ArrayBuffers
  *  - arrays of embedder types
  *
  *
@@ -249,6 +257,14 @@ class CTypeInfo {
     kV8Value,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
+    // The 8-bit and 16-bit integer types are only supported as TypedArray
+    // element types.
+    kInt8,
+    kUint8,
+    kInt16,
+    kUint16,
+    kSeqOneByteString,
+    kSeqTwoByteString,
   };
 
   // kCallbackOptionsType is not part of the Type enum
@@ -306,6 +322,12 @@ class CTypeInfo {
            type == Type::kBool;
   }
 
+  static constexpr bool IsTypedArrayElementType(Type type) {
+    return IsIntegralType(type) || IsFloatingPointType(type) ||
+           type == Type::kInt8 || type == Type::kUint8 ||
+           type == Type::kInt16 || type == Type::kUint16;
+  }
+
  private:
   Type type_;
   SequenceType sequence_type_;
@@ -368,6 +390,20 @@ struct FastApiArrayBuffer {
   size_t byte_length;
 };
 
+// A view on the characters of a flat sequential string. The characters are
+// not null-terminated, and the view is only valid for the duration of the
+// fast call. Any other kind of string, e.g. a cons string or an external
+// string, takes the slow path instead.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   // Construct a struct to hold a CFunction's type information.
@@ -638,6 +674,10 @@ PRIMITIVE_C_TYPES(DEFINE_TYPE_INFO_TRAITS)
   };
 
 #define TYPED_ARRAY_C_TYPES(V) \
+  V(int8_t, kInt8)             \
+  V(uint8_t, kUint8)           \
+  V(int16_t, kInt16)           \
+  V(uint16_t, kUint16)         \
   V(int32_t, kInt32)           \
   V(uint32_t, kUint32)         \
   V(int64_t, kInt64)           \
@@ -649,6 +689,30 @@ TYPED_ARRAY_C_TYPES(SPECIALIZE_GET_TYPE_INFO_HELPER_FOR_TA)
 
 #undef TYPED_ARRAY_C_TYPES
 
+template <>
+struct TypeInfoHelper<const FastOneByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqOneByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
+template <>
+struct TypeInfoHelper<const FastTwoByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqTwoByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
 template <>
 struct TypeInfoHelper<v8::Local<v8::Array>> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
@@ -718,7 +782,8 @@ class CTypeInfoBuilder {
                           "Sequences are only supported from void type.");
     STATIC_ASSERT_IMPLIES(
         kSequenceType == CTypeInfo::SequenceType::kIsTypedArray,
-        CTypeInfo::IsPrimitive(kType) || kType == CTypeInfo::Type::kVoid,
+        CTypeInfo::IsTypedArrayElementType(kType) ||
+            kType == CTypeInfo::Type::kVoid,
         "TypedArrays are only supported from primitive types or void.");
 
     // Return the same type with the merged flags.
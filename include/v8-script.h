@@ -489,6 +489,11 @@ class V8_EXPORT ScriptCompiler {
 
     StreamedSource(std::unique_ptr<ExternalSourceStream> source_stream,
                    Encoding encoding);
+    // Compiles the functions starting at the source positions in
+    // |compile_hints| eagerly on the streaming thread, like
+    // kConsumeCompileHints does for ScriptCompiler::Compile.
+    StreamedSource(std::unique_ptr<ExternalSourceStream> source_stream,
+                   Encoding encoding, std::vector<int> compile_hints);
     ~StreamedSource();
 
     internal::ScriptStreamingData* impl() const { return impl_.get(); }
@@ -538,10 +543,29 @@ class V8_EXPORT ScriptCompiler {
     std::unique_ptr<internal::BackgroundDeserializeTask> impl_;
   };
 
+  /**
+   * kProducePreparseCache and kConsumePreparseCache are for classic scripts
+   * only. kProducePreparseCache stores what the preparser learned about the
+   * script's lazy top-level functions in the Source's cached data, and
+   * kConsumePreparseCache lets a later compile of the same source skip those
+   * functions. Unlike the code cache, the preparse cache holds no heap
+   * objects.
+   *
+   * kConsumeCompileHints is for classic scripts only. The Source's cached data
+   * then holds the source positions of functions to compile eagerly, as an
+   * array of int32_t in host byte order, e.g. the function start offsets
+   * reported by code coverage. Hints for functions nested inside functions
+   * that are compiled lazily have no effect. The cached data is rejected, and
+   * the script compiled without hints, if its length is not a multiple of 4
+   * or it holds a negative position.
+   */
   enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache,
-    kEagerCompile
+    kEagerCompile,
+    kProducePreparseCache,
+    kConsumePreparseCache,
+    kConsumeCompileHints
   };
 
   /**
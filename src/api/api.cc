@@ -101,6 +101,7 @@
 #include "src/parsing/parser.h"
 #include "src/parsing/pending-compilation-error-handler.h"
 #include "src/parsing/scanner-character-streams.h"
+#include "src/parsing/script-preparse-cache.h"
 #include "src/profiler/cpu-profiler.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
@@ -1967,6 +1968,12 @@ ScriptCompiler::StreamedSource::StreamedSource(
     std::unique_ptr<ExternalSourceStream> stream, Encoding encoding)
     : impl_(new i::ScriptStreamingData(std::move(stream), encoding)) {}
 
+ScriptCompiler::StreamedSource::StreamedSource(
+    std::unique_ptr<ExternalSourceStream> stream, Encoding encoding,
+    std::vector<int> compile_hints)
+    : impl_(new i::ScriptStreamingData(std::move(stream), encoding,
+                                       std::move(compile_hints))) {}
+
 ScriptCompiler::StreamedSource::~StreamedSource() = default;
 
 Local<Script> UnboundScript::BindToCurrentContext() {
@@ -2470,6 +2477,27 @@ i::ScriptDetails GetScriptDetails(i::Isolate* isolate,
   return script_details;
 }
 
+// Reads the int32_t source positions of kConsumeCompileHints into
+// |compile_hints|, sorted for lookup.
+bool DecodeCompileHints(const uint8_t* data, int length,
+                        std::vector<int>* compile_hints) {
+  size_t size = static_cast<size_t>(length);
+  if (size % sizeof(int32_t) != 0) return false;
+  compile_hints->resize(size / sizeof(int32_t));
+  for (size_t i = 0; i < compile_hints->size(); ++i) {
+    int32_t position;
+    // The embedder's buffer need not be aligned.
+    memcpy(&position, data + i * sizeof(int32_t), sizeof(int32_t));
+    if (position < 0) {
+      compile_hints->clear();
+      return false;
+    }
+    (*compile_hints)[i] = position;
+  }
+  std::sort(compile_hints->begin(), compile_hints->end());
+  return true;
+}
+
 }  // namespace
 
 MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
@@ -2514,6 +2542,45 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
               no_cache_reason, i::NOT_NATIVES_CODE);
       source->cached_data->rejected = cached_data->rejected();
     }
+  } else if (options == kProducePreparseCache ||
+             options == kConsumePreparseCache) {
+    i::Zone zone(isolate->allocator(), ZONE_NAME);
+    i::ScriptPreparseCache* preparse_cache = nullptr;
+    if (options == kConsumePreparseCache) {
+      DCHECK(source->cached_data);
+      preparse_cache = i::ScriptPreparseCache::Deserialize(
+          &zone,
+          i::base::Vector<const uint8_t>(source->cached_data->data,
+                                         source->cached_data->length),
+          isolate, str);
+      source->cached_data->rejected = preparse_cache == nullptr;
+    } else {
+      DCHECK(!source->cached_data);
+    }
+    if (preparse_cache == nullptr) {
+      preparse_cache = zone.New<i::ScriptPreparseCache>(&zone);
+    }
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithPreparseCache(
+            isolate, str, script_details, preparse_cache, options,
+            no_cache_reason, i::NOT_NATIVES_CODE);
+    if (options == kProducePreparseCache && !maybe_function_info.is_null()) {
+      std::vector<uint8_t> data = preparse_cache->Serialize(isolate, str);
+      uint8_t* buffer = new uint8_t[data.size()];
+      std::copy(data.begin(), data.end(), buffer);
+      source->cached_data = std::make_unique<CachedData>(
+          buffer, static_cast<int>(data.size()), CachedData::BufferOwned);
+    }
+  } else if (options == kConsumeCompileHints) {
+    DCHECK(source->cached_data);
+    std::vector<int> compile_hints;
+    source->cached_data->rejected = !DecodeCompileHints(
+        source->cached_data->data, source->cached_data->length,
+        &compile_hints);
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+            isolate, str, script_details, i::base::VectorOf(compile_hints),
+            options, no_cache_reason, i::NOT_NATIVES_CODE);
   } else {
     // Compile without any cache.
     maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
@@ -338,6 +338,17 @@ const AstRawString* AstValueFactory::GetTwoByteStringInternal(
                    base::Vector<const byte>::cast(literal));
 }
 
+const AstRawString* AstValueFactory::GetOneByteStringFromStableSource(
+    base::Vector<const uint8_t> literal) {
+  DCHECK_LE(stable_one_byte_source_.begin(), literal.begin());
+  DCHECK_LE(literal.end(), stable_one_byte_source_.end());
+  // Single characters are cached separately.
+  if (literal.length() == 1) return GetOneByteStringInternal(literal);
+  uint32_t raw_hash_field = StringHasher::HashSequentialString<uint8_t>(
+      literal.begin(), literal.length(), hash_seed_);
+  return GetString(raw_hash_field, true, literal, false);
+}
+
 const AstRawString* AstValueFactory::GetString(Handle<String> literal) {
   const AstRawString* result = nullptr;
   DisallowGarbageCollection no_gc;
@@ -395,7 +406,7 @@ template EXPORT_TEMPLATE_DEFINE(
 
 const AstRawString* AstValueFactory::GetString(
     uint32_t raw_hash_field, bool is_one_byte,
-    base::Vector<const byte> literal_bytes) {
+    base::Vector<const byte> literal_bytes, bool copy_literal_bytes) {
   // literal_bytes here points to whatever the user passed, and this is OK
   // because we use vector_compare (which checks the contents) to compare
   // against the AstRawStrings which are in the string_table_. We should not
@@ -404,13 +415,17 @@ const AstRawString* AstValueFactory::GetString(
   AstRawStringMap::Entry* entry = string_table_.LookupOrInsert(
       &key, key.Hash(),
       [&]() {
-        // Copy literal contents for later comparison.
-        int length = literal_bytes.length();
-        byte* new_literal_bytes = zone()->NewArray<byte>(length);
-        memcpy(new_literal_bytes, literal_bytes.begin(), length);
+        // Copy literal contents for later comparison, unless they outlive the
+        // factory anyway.
+        base::Vector<const byte> new_literal_bytes = literal_bytes;
+        if (copy_literal_bytes) {
+          int length = literal_bytes.length();
+          byte* copy = zone()->NewArray<byte>(length);
+          memcpy(copy, literal_bytes.begin(), length);
+          new_literal_bytes = base::Vector<const byte>(copy, length);
+        }
         AstRawString* new_string = zone()->New<AstRawString>(
-            is_one_byte, base::Vector<const byte>(new_literal_bytes, length),
-            raw_hash_field);
+            is_one_byte, new_literal_bytes, raw_hash_field);
         CHECK_NOT_NULL(new_string);
         AddString(new_string);
         return new_string;
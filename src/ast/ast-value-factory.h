@@ -29,6 +29,7 @@
 #define V8_AST_AST_VALUE_FACTORY_H_
 
 #include <forward_list>
+#include <memory>
 
 #include "src/base/hashmap.h"
 #include "src/base/logging.h"
@@ -342,6 +343,23 @@ class AstValueFactory {
   }
   const AstRawString* GetString(Handle<String> literal);
 
+  // Lets strings whose characters lie within |chars| reference them instead
+  // of copying them into the zone. |lock| keeps |chars| valid for as long as
+  // this factory is alive.
+  void set_stable_one_byte_source(base::Vector<const uint8_t> chars,
+                                  std::shared_ptr<const void> lock) {
+    stable_one_byte_source_ = chars;
+    stable_one_byte_source_lock_ = std::move(lock);
+  }
+  base::Vector<const uint8_t> stable_one_byte_source() const {
+    return stable_one_byte_source_;
+  }
+
+  // Like GetOneByteString, but |literal| must lie within
+  // stable_one_byte_source(), and is referenced rather than copied.
+  V8_EXPORT_PRIVATE const AstRawString* GetOneByteStringFromStableSource(
+      base::Vector<const uint8_t> literal);
+
   // Clones an AstRawString from another ast value factory, adding it to this
   // factory and returning the clone.
   const AstRawString* CloneFromOtherFactory(const AstRawString* raw_string);
@@ -380,9 +398,11 @@ class AstValueFactory {
   const AstRawString* GetTwoByteStringInternal(
       base::Vector<const uint16_t> literal);
   const AstRawString* GetString(uint32_t raw_hash_field, bool is_one_byte,
-                                base::Vector<const byte> literal_bytes);
+                                base::Vector<const byte> literal_bytes,
+                                bool copy_literal_bytes = true);
 
-  // All strings are copied here.
+  // All strings are copied here, except for those referencing the stable
+  // source.
   AstRawStringMap string_table_;
 
   AstRawString* strings_;
@@ -400,6 +420,9 @@ class AstValueFactory {
   Zone* zone_;
 
   uint64_t hash_seed_;
+
+  base::Vector<const uint8_t> stable_one_byte_source_;
+  std::shared_ptr<const void> stable_one_byte_source_lock_;
 };
 
 extern template EXPORT_TEMPLATE_DECLARE(
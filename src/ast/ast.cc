@@ -219,6 +219,10 @@ void FunctionLiteral::SetShouldEagerCompile() {
   scope()->set_should_eager_compile();
 }
 
+void FunctionLiteral::SetShouldLazyCompile() {
+  scope()->set_should_lazy_compile();
+}
+
 bool FunctionLiteral::AllowsLazyCompilation() {
   return scope()->AllowsLazyCompilation();
 }
@@ -2199,6 +2199,7 @@ class FunctionLiteral final : public Expression {
   // - var x = function() { ... }();
   V8_EXPORT_PRIVATE bool ShouldEagerCompile() const;
   V8_EXPORT_PRIVATE void SetShouldEagerCompile();
+  V8_EXPORT_PRIVATE void SetShouldLazyCompile();
 
   FunctionSyntaxKind syntax_kind() const {
     return FunctionSyntaxKindBits::decode(bit_field_);
@@ -2271,6 +2271,43 @@ void Scope::ResolvePreparsedVariable(VariableProxy* proxy, Scope* scope,
   }
 }
 
+bool Scope::CanReuseResolvedVariables() const {
+  // Lookups through a with scope mark the outer variable as maybe assigned
+  // depending on the individual reference.
+  for (const Scope* scope = this; scope != nullptr;
+       scope = scope->outer_scope_) {
+    if (scope->is_with_scope()) return false;
+  }
+  return true;
+}
+
+void Scope::ResolveUnresolvedVariables() {
+  // Large scopes often refer to the same names many times. Once a scope has
+  // resolved enough references, the results are recorded by name so that
+  // later references to the same name don't walk the scope chain again. This
+  // is only done if every lookup of a name yields the same variable, with the
+  // same side effects on it.
+  static constexpr int kMinReferencesToReuse = 16;
+  base::Optional<VariableMap> resolved;
+  int count = 0;
+  for (VariableProxy* proxy : unresolved_list_) {
+    if (resolved.has_value()) {
+      Variable* var = resolved->Lookup(proxy->raw_name());
+      if (var != nullptr) {
+        ResolveTo(proxy, var);
+        continue;
+      }
+      ResolveVariable(proxy);
+      resolved->Add(proxy->var());
+      continue;
+    }
+    ResolveVariable(proxy);
+    if (++count == kMinReferencesToReuse && CanReuseResolvedVariables()) {
+      resolved.emplace(zone());
+    }
+  }
+}
+
 bool Scope::ResolveVariablesRecursively(Scope* end) {
   // Lazy parsed declaration scopes are already partially analyzed. If there are
   // unresolved references remaining, they just need to be resolved in outer
@@ -2284,10 +2321,7 @@ bool Scope::ResolveVariablesRecursively(Scope* end) {
       ResolvePreparsedVariable(proxy, outer_scope(), end);
     }
   } else {
-    // Resolve unresolved variables for this scope.
-    for (VariableProxy* proxy : unresolved_list_) {
-      ResolveVariable(proxy);
-    }
+    ResolveUnresolvedVariables();
 
     // Resolve unresolved variables for inner scopes.
     for (Scope* scope = inner_scope_; scope != nullptr;
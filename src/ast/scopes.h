@@ -693,6 +693,8 @@ class V8_EXPORT_PRIVATE Scope : public NON_EXPORTED_BASE(ZoneObject) {
                                        Scope* end);
   void ResolveTo(VariableProxy* proxy, Variable* var);
   void ResolveVariable(VariableProxy* proxy);
+  void ResolveUnresolvedVariables();
+  bool CanReuseResolvedVariables() const;
   V8_WARN_UNUSED_RESULT bool ResolveVariablesRecursively(Scope* end);
 
   // Finds free variables of this scope. This mutates the unresolved variables
@@ -969,6 +971,7 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   }
 
   void set_should_eager_compile();
+  void set_should_lazy_compile() { should_eager_compile_ = false; }
 
   void SetScriptScopeInfo(Handle<ScopeInfo> scope_info) {
     DCHECK(is_script_scope());
@@ -206,6 +206,13 @@ void BaselineAssembler::JumpIfByte(Condition cc, Register value, int32_t byte,
                                    Label* target, Label::Distance) {
   JumpIf(cc, value, Operand(byte), target);
 }
+void BaselineAssembler::JumpIfNotWeakReferenceTo(Register value,
+                                                 Register object,
+                                                 Label* target) {
+  __ LoadWeakValue(value, value, target);
+  __ cmp(value, object);
+  __ b(ne, target);
+}
 
 void BaselineAssembler::Move(interpreter::Register output, Register source) {
   Move(RegisterFrameOperand(output), source);
@@ -354,6 +361,12 @@ void BaselineAssembler::LoadTaggedAnyField(Register output, Register source,
                                            int offset) {
   __ ldr(output, FieldMemOperand(source, offset));
 }
+void BaselineAssembler::LoadTaggedAnyFieldByIndex(Register output,
+                                                  Register source,
+                                                  Register index) {
+  __ add(output, source, Operand(index, LSL, kTaggedSizeLog2));
+  __ ldr(output, FieldMemOperand(output, 0));
+}
 void BaselineAssembler::LoadByteField(Register output, Register source,
                                       int offset) {
   __ ldrb(output, FieldMemOperand(source, offset));
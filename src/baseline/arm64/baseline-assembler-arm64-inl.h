@@ -222,6 +222,12 @@ void BaselineAssembler::JumpIfByte(Condition cc, Register value, int32_t byte,
                                    Label* target, Label::Distance) {
   JumpIf(cc, value, Immediate(byte), target);
 }
+void BaselineAssembler::JumpIfNotWeakReferenceTo(Register value,
+                                                 Register object,
+                                                 Label* target) {
+  __ LoadWeakValue(value, value, target);
+  __ CompareAndBranch(value, Operand(object), ne, target);
+}
 
 void BaselineAssembler::Move(interpreter::Register output, Register source) {
   Move(RegisterFrameOperand(output), source);
@@ -427,6 +433,12 @@ void BaselineAssembler::LoadTaggedAnyField(Register output, Register source,
                                            int offset) {
   __ LoadAnyTaggedField(output, FieldMemOperand(source, offset));
 }
+void BaselineAssembler::LoadTaggedAnyFieldByIndex(Register output,
+                                                  Register source,
+                                                  Register index) {
+  __ Add(output, source, Operand(index, LSL, kTaggedSizeLog2));
+  __ LoadAnyTaggedField(output, FieldMemOperand(output, 0));
+}
 void BaselineAssembler::LoadByteField(Register output, Register source,
                                       int offset) {
   __ Ldrb(output, FieldMemOperand(source, offset));
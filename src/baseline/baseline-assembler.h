@@ -85,6 +85,10 @@ class BaselineAssembler {
                            Label::Distance distance = Label::kFar);
   inline void JumpIfByte(Condition cc, Register value, int32_t byte,
                          Label* target, Label::Distance distance = Label::kFar);
+  // Jumps to |target| unless |value| holds a weak reference to |object|.
+  // Clobbers |value|.
+  inline void JumpIfNotWeakReferenceTo(Register value, Register object,
+                                       Label* target);
 
   inline void LoadMap(Register output, Register value);
   inline void LoadRoot(Register output, RootIndex index);
@@ -158,6 +162,9 @@ class BaselineAssembler {
                                              Register value);
   inline void LoadFixedArrayElement(Register output, Register array,
                                     int32_t index);
+  // Loads the tagged field |index| words from the start of |source|.
+  inline void LoadTaggedAnyFieldByIndex(Register output, Register source,
+                                        Register index);
   inline void LoadPrototype(Register prototype, Register object);
 
   // Loads the feedback cell from the function, and sets flags on add so that
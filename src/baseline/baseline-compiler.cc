@@ -25,10 +25,12 @@
 #include "src/common/globals.h"
 #include "src/execution/frame-constants.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/ic/handler-configuration.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/code.h"
+#include "src/objects/feedback-vector.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/literal-objects-inl.h"
@@ -838,9 +840,53 @@ void BaselineCompiler::VisitMov() {
 }
 
 void BaselineCompiler::VisitLdaNamedProperty() {
+  Label done;
+  if (FLAG_sparkplug_inline_property_loads) {
+    // Handle a monomorphic IC whose handler loads an in-object field of the
+    // receiver inline, and leave every other case to the IC builtin. This is
+    // the same fast path the builtin takes, minus the call.
+    Label slow;
+    {
+      BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+      Register feedback_vector = scratch_scope.AcquireScratch();
+      Register map = scratch_scope.AcquireScratch();
+      Register scratch = scratch_scope.AcquireScratch();
+      Register receiver = kInterpreterAccumulatorRegister;
+      int slot = Index(2);
+
+      LoadRegister(receiver, 0);
+      __ JumpIfSmi(receiver, &slow);
+      __ LoadMap(map, receiver);
+      LoadFeedbackVector(feedback_vector);
+      __ LoadTaggedAnyField(scratch, feedback_vector,
+                            FeedbackVector::OffsetOfElementAt(slot));
+      __ JumpIfNotWeakReferenceTo(scratch, map, &slow);
+
+      __ LoadTaggedAnyField(scratch, feedback_vector,
+                            FeedbackVector::OffsetOfElementAt(slot + 1));
+      __ JumpIfNotSmi(scratch, &slow);
+      __ SmiUntag(scratch);
+      constexpr int kFieldKind =
+          LoadHandler::KindBits::encode(LoadHandler::Kind::kField);
+      __ TestAndBranch(scratch,
+                       (LoadHandler::KindBits::kMask & ~kFieldKind) |
+                           LoadHandler::IsWasmStructBits::kMask |
+                           LoadHandler::IsDoubleBits::kMask,
+                       Condition::kNotZero, &slow);
+      __ TestAndBranch(scratch, kFieldKind, Condition::kZero, &slow);
+      __ TestAndBranch(scratch, LoadHandler::IsInobjectBits::kMask,
+                       Condition::kZero, &slow);
+      __ masm()->DecodeField<LoadHandler::FieldIndexBits>(scratch);
+      __ LoadTaggedAnyFieldByIndex(kInterpreterAccumulatorRegister, receiver,
+                                   scratch);
+      __ Jump(&done);
+    }
+    __ Bind(&slow);
+  }
   CallBuiltin<Builtin::kLoadICBaseline>(RegisterOperand(0),  // object
                                         Constant<Name>(1),   // name
                                         IndexAsTagged(2));   // slot
+  __ Bind(&done);
 }
 
 void BaselineCompiler::VisitLdaNamedPropertyFromSuper() {
@@ -202,6 +202,13 @@ void BaselineAssembler::JumpIfByte(Condition cc, Register value, int32_t byte,
   __ cmpb(value, Immediate(byte));
   __ j(AsMasmCondition(cc), target, distance);
 }
+void BaselineAssembler::JumpIfNotWeakReferenceTo(Register value,
+                                                 Register object,
+                                                 Label* target) {
+  __ LoadWeakValue(value, target);
+  __ cmp(value, object);
+  __ j(not_equal, target);
+}
 void BaselineAssembler::Move(interpreter::Register output, Register source) {
   return __ mov(RegisterFrameOperand(output), source);
 }
@@ -326,6 +333,11 @@ void BaselineAssembler::LoadTaggedAnyField(Register output, Register source,
                                            int offset) {
   __ mov(output, FieldOperand(source, offset));
 }
+void BaselineAssembler::LoadTaggedAnyFieldByIndex(Register output,
+                                                  Register source,
+                                                  Register index) {
+  __ mov(output, FieldOperand(source, index, times_tagged_size, 0));
+}
 void BaselineAssembler::LoadByteField(Register output, Register source,
                                       int offset) {
   __ mov_b(output, FieldOperand(source, offset));
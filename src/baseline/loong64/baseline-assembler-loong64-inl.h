@@ -193,6 +193,12 @@ void BaselineAssembler::JumpIfByte(Condition cc, Register value, int32_t byte,
                                    Label* target, Label::Distance) {
   __ Branch(target, AsMasmCondition(cc), value, Operand(byte));
 }
+void BaselineAssembler::JumpIfNotWeakReferenceTo(Register value,
+                                                 Register object,
+                                                 Label* target) {
+  __ LoadWeakValue(value, value, target);
+  __ Branch(target, ne, value, Operand(object));
+}
 void BaselineAssembler::Move(interpreter::Register output, Register source) {
   Move(RegisterFrameOperand(output), source);
 }
@@ -341,6 +347,12 @@ void BaselineAssembler::LoadTaggedAnyField(Register output, Register source,
                                            int offset) {
   __ Ld_d(output, FieldMemOperand(source, offset));
 }
+void BaselineAssembler::LoadTaggedAnyFieldByIndex(Register output,
+                                                  Register source,
+                                                  Register index) {
+  __ Alsl_d(output, index, source, kTaggedSizeLog2);
+  __ Ld_d(output, FieldMemOperand(output, 0));
+}
 void BaselineAssembler::LoadByteField(Register output, Register source,
                                       int offset) {
   __ Ld_b(output, FieldMemOperand(source, offset));
@@ -203,6 +203,12 @@ void BaselineAssembler::JumpIfByte(Condition cc, Register value, int32_t byte,
                                    Label* target, Label::Distance) {
   __ Branch(target, AsMasmCondition(cc), value, Operand(byte));
 }
+void BaselineAssembler::JumpIfNotWeakReferenceTo(Register value,
+                                                 Register object,
+                                                 Label* target) {
+  __ LoadWeakValue(value, value, target);
+  __ Branch(target, ne, value, Operand(object));
+}
 
 void BaselineAssembler::Move(interpreter::Register output, Register source) {
   Move(RegisterFrameOperand(output), source);
@@ -351,6 +357,12 @@ void BaselineAssembler::LoadTaggedAnyField(Register output, Register source,
                                            int offset) {
   __ Lw(output, FieldMemOperand(source, offset));
 }
+void BaselineAssembler::LoadTaggedAnyFieldByIndex(Register output,
+                                                  Register source,
+                                                  Register index) {
+  __ Lsa(output, source, index, kTaggedSizeLog2);
+  __ Lw(output, FieldMemOperand(output, 0));
+}
 void BaselineAssembler::LoadByteField(Register output, Register source,
                                       int offset) {
   __ lb(output, FieldMemOperand(source, offset));
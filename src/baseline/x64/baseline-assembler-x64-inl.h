@@ -208,6 +208,13 @@ void BaselineAssembler::JumpIfByte(Condition cc, Register value, int32_t byte,
   __ cmpb(value, Immediate(byte));
   __ j(AsMasmCondition(cc), target, distance);
 }
+void BaselineAssembler::JumpIfNotWeakReferenceTo(Register value,
+                                                 Register object,
+                                                 Label* target) {
+  __ LoadWeakValue(value, target);
+  __ cmpq(value, object);
+  __ j(not_equal, target);
+}
 
 void BaselineAssembler::Move(interpreter::Register output, Register source) {
   return __ movq(RegisterFrameOperand(output), source);
@@ -333,6 +340,12 @@ void BaselineAssembler::LoadTaggedAnyField(Register output, Register source,
                                            int offset) {
   __ LoadAnyTaggedField(output, FieldOperand(source, offset));
 }
+void BaselineAssembler::LoadTaggedAnyFieldByIndex(Register output,
+                                                  Register source,
+                                                  Register index) {
+  __ LoadAnyTaggedField(output,
+                        FieldOperand(source, index, times_tagged_size, 0));
+}
 void BaselineAssembler::LoadByteField(Register output, Register source,
                                       int offset) {
   __ movb(output, FieldOperand(source, offset));
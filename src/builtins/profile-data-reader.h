@@ -27,6 +27,10 @@ class ProfileDataFromFile {
                                                  : 0;
   }
 
+  // Returns how many times the function was called during profiling. The
+  // schedule's start block always has ID 0.
+  double GetExecutionCount() const { return GetCounter(0); }
+
   // Load basic block profiling data for the builtin with the given name, if
   // such data exists. The returned vector is indexed by block ID, and its
   // values are the number of times each block was executed while profiling.
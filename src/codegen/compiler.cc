@@ -995,7 +995,13 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
                            Isolate* isolate,
                            OptimizedCompilationInfo* compilation_info,
                            CodeKind code_kind, Handle<JSFunction> function) {
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  OptimizingCompileDispatcher* dispatcher =
+      isolate->optimizing_compile_dispatcher();
+  if (!dispatcher->IsQueueAvailable()) {
+    // Make room by dropping jobs whose results would be discarded anyway.
+    dispatcher->CancelObsoleteJobs();
+  }
+  if (!dispatcher->IsQueueAvailable()) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -1023,7 +1029,7 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
   }
 
   // The background recompile will own this job.
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job.get());
+  dispatcher->QueueForOptimization(job.get());
   job.release();
 
   if (FLAG_trace_concurrent_recompilation) {
@@ -1513,6 +1519,7 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
   std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(
       streamed_data->source_stream.get(), streamed_data->encoding));
   info_->set_character_stream(std::move(stream));
+  info_->set_compile_hints(base::VectorOf(streamed_data->compile_hints));
 }
 
 BackgroundCompileTask::BackgroundCompileTask(
@@ -1540,7 +1547,8 @@ BackgroundCompileTask::BackgroundCompileTask(
 
   // Clone the character stream so both can be accessed independently.
   std::unique_ptr<Utf16CharacterStream> character_stream =
-      outer_parse_info->character_stream()->Clone();
+      outer_parse_info->character_stream()->CloneForParallelAccess(
+          start_position_, end_position_);
   character_stream->Seek(start_position_);
   info_->set_character_stream(std::move(character_stream));
 
@@ -1840,6 +1848,16 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (shared_info->bytecode_was_flushed()) {
+    isolate->counters()->bytecode_recompiled_after_flush()->Increment();
+    if (FLAG_trace_flush_bytecode) {
+      CodeTracer::Scope scope(isolate->GetCodeTracer());
+      PrintF(scope.file(), "[recompiling flushed function ");
+      shared_info->ShortPrint(scope.file());
+      PrintF(scope.file(), "]\n");
+    }
+  }
+
   Handle<Script> script(Script::cast(shared_info->script()), isolate);
 
   // Set up parse info.
@@ -2682,11 +2700,14 @@ Handle<Script> NewScript(
 MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
     const UnoptimizedCompileFlags flags, Handle<String> source,
     const ScriptDetails& script_details, NativesFlag natives,
-    v8::Extension* extension, Isolate* isolate,
+    v8::Extension* extension, ScriptPreparseCache* preparse_cache,
+    base::Vector<const int> compile_hints, Isolate* isolate,
     IsCompiledScope* is_compiled_scope) {
   UnoptimizedCompileState compile_state(isolate);
   ParseInfo parse_info(isolate, flags, &compile_state);
   parse_info.set_extension(extension);
+  parse_info.set_script_preparse_cache(preparse_cache);
+  parse_info.set_compile_hints(compile_hints);
 
   Handle<Script> script =
       NewScript(isolate, &parse_info, source, script_details, natives);
@@ -2792,8 +2813,8 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnBothBackgroundAndMainThread(
     TryCatch ignore_try_catch(reinterpret_cast<v8::Isolate*>(isolate));
     flags_copy.set_script_id(Script::kTemporaryScriptId);
     main_thread_maybe_result = CompileScriptOnMainThread(
-        flags_copy, source, script_details, NOT_NATIVES_CODE, nullptr, isolate,
-        &inner_is_compiled_scope);
+        flags_copy, source, script_details, NOT_NATIVES_CODE, nullptr, nullptr,
+        {}, isolate, &inner_is_compiled_scope);
     if (main_thread_maybe_result.is_null()) {
       // Assume all range errors are stack overflows.
       main_thread_had_stack_overflow = CompilationExceptionIsRangeError(
@@ -2837,6 +2858,7 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     Isolate* isolate, Handle<String> source,
     const ScriptDetails& script_details, v8::Extension* extension,
     AlignedCachedData* cached_data, BackgroundDeserializeTask* deserialize_task,
+    ScriptPreparseCache* preparse_cache, base::Vector<const int> compile_hints,
     ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
@@ -2845,13 +2867,28 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
       compile_options == ScriptCompiler::kEagerCompile) {
     DCHECK_NULL(cached_data);
     DCHECK_NULL(deserialize_task);
+    DCHECK_NULL(preparse_cache);
+  } else if (compile_options == ScriptCompiler::kProducePreparseCache ||
+             compile_options == ScriptCompiler::kConsumePreparseCache) {
+    DCHECK_NULL(cached_data);
+    DCHECK_NULL(deserialize_task);
+    DCHECK_NOT_NULL(preparse_cache);
+    DCHECK(!script_details.origin_options.IsModule());
+  } else if (compile_options == ScriptCompiler::kConsumeCompileHints) {
+    DCHECK_NULL(cached_data);
+    DCHECK_NULL(deserialize_task);
+    DCHECK_NULL(preparse_cache);
+    DCHECK(!script_details.origin_options.IsModule());
   } else {
     DCHECK_EQ(compile_options, ScriptCompiler::kConsumeCodeCache);
     // Have to have exactly one of cached_data or deserialize_task.
     DCHECK(cached_data || deserialize_task);
     DCHECK(!(cached_data && deserialize_task));
+    DCHECK_NULL(preparse_cache);
     DCHECK_NULL(extension);
   }
+  DCHECK_IMPLIES(compile_options != ScriptCompiler::kConsumeCompileHints,
+                 compile_hints.empty());
   int source_length = source->length();
   isolate->counters()->total_load_size()->Increment(source_length);
   isolate->counters()->total_compile_size()->Increment(source_length);
@@ -2893,9 +2930,12 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
       compile_timer.set_consuming_code_cache();
     }
 
-    // First check per-isolate compilation cache.
-    maybe_result =
-        compilation_cache->LookupScript(source, script_details, language_mode);
+    // First check per-isolate compilation cache. Producing a preparse cache
+    // needs an actual parse, so it skips the lookup.
+    if (compile_options != ScriptCompiler::kProducePreparseCache) {
+      maybe_result = compilation_cache->LookupScript(source, script_details,
+                                                     language_mode);
+    }
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
     } else if (can_consume_code_cache) {
@@ -2954,7 +2994,8 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
 
       maybe_result =
           CompileScriptOnMainThread(flags, source, script_details, natives,
-                                    extension, isolate, &is_compiled_scope);
+                                    extension, preparse_cache, compile_hints,
+                                    isolate, &is_compiled_scope);
     }
 
     // Add the result to the isolate cache.
@@ -2978,7 +3019,7 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
-      isolate, source, script_details, nullptr, nullptr, nullptr,
+      isolate, source, script_details, nullptr, nullptr, nullptr, nullptr, {},
       compile_options, no_cache_reason, natives);
 }
 
@@ -2988,8 +3029,9 @@ Compiler::GetSharedFunctionInfoForScriptWithExtension(
     const ScriptDetails& script_details, v8::Extension* extension,
     ScriptCompiler::CompileOptions compile_options, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
-      isolate, source, script_details, extension, nullptr, nullptr,
-      compile_options, ScriptCompiler::kNoCacheBecauseV8Extension, natives);
+      isolate, source, script_details, extension, nullptr, nullptr, nullptr,
+      {}, compile_options, ScriptCompiler::kNoCacheBecauseV8Extension,
+      natives);
 }
 
 MaybeHandle<SharedFunctionInfo>
@@ -2999,8 +3041,8 @@ Compiler::GetSharedFunctionInfoForScriptWithCachedData(
     ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
-      isolate, source, script_details, nullptr, cached_data, nullptr,
-      compile_options, no_cache_reason, natives);
+      isolate, source, script_details, nullptr, cached_data, nullptr, nullptr,
+      {}, compile_options, no_cache_reason, natives);
 }
 
 MaybeHandle<SharedFunctionInfo>
@@ -3012,7 +3054,29 @@ Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask(
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   return GetSharedFunctionInfoForScriptImpl(
       isolate, source, script_details, nullptr, nullptr, deserialize_task,
-      compile_options, no_cache_reason, natives);
+      nullptr, {}, compile_options, no_cache_reason, natives);
+}
+
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithPreparseCache(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details, ScriptPreparseCache* preparse_cache,
+    ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, nullptr, nullptr, nullptr,
+      preparse_cache, {}, compile_options, no_cache_reason, natives);
+}
+
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithCompileHints(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details, base::Vector<const int> compile_hints,
+    ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, nullptr, nullptr, nullptr, nullptr,
+      compile_hints, compile_options, no_cache_reason, natives);
 }
 
 // static
@@ -3441,6 +3505,16 @@ ScriptStreamingData::ScriptStreamingData(
     ScriptCompiler::StreamedSource::Encoding encoding)
     : source_stream(std::move(source_stream)), encoding(encoding) {}
 
+ScriptStreamingData::ScriptStreamingData(
+    std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream,
+    ScriptCompiler::StreamedSource::Encoding encoding,
+    std::vector<int> compile_hints)
+    : source_stream(std::move(source_stream)),
+      encoding(encoding),
+      compile_hints(std::move(compile_hints)) {
+  std::sort(this->compile_hints.begin(), this->compile_hints.end());
+}
+
 ScriptStreamingData::~ScriptStreamingData() = default;
 
 void ScriptStreamingData::Release() { task.reset(); }
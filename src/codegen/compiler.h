@@ -7,6 +7,7 @@
 
 #include <forward_list>
 #include <memory>
+#include <vector>
 
 #include "src/base/platform/elapsed-timer.h"
 #include "src/codegen/bailout-reason.h"
@@ -37,6 +38,7 @@ class OptimizedCompilationJob;
 class ParseInfo;
 class Parser;
 class RuntimeCallStats;
+class ScriptPreparseCache;
 class TimedHistogram;
 class UnoptimizedCompilationInfo;
 class UnoptimizedCompilationJob;
@@ -185,6 +187,29 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       ScriptCompiler::NoCacheReason no_cache_reason,
       NativesFlag is_natives_code);
 
+  // Create a shared function info object for a String source, skipping the
+  // lazy top-level functions recorded in |preparse_cache| and recording the
+  // ones that had to be preparsed.
+  static MaybeHandle<SharedFunctionInfo>
+  GetSharedFunctionInfoForScriptWithPreparseCache(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details, ScriptPreparseCache* preparse_cache,
+      ScriptCompiler::CompileOptions compile_options,
+      ScriptCompiler::NoCacheReason no_cache_reason,
+      NativesFlag is_natives_code);
+
+  // Create a shared function info object for a String source, compiling the
+  // functions starting at the sorted source positions in |compile_hints|
+  // eagerly.
+  static MaybeHandle<SharedFunctionInfo>
+  GetSharedFunctionInfoForScriptWithCompileHints(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details,
+      base::Vector<const int> compile_hints,
+      ScriptCompiler::CompileOptions compile_options,
+      ScriptCompiler::NoCacheReason no_cache_reason,
+      NativesFlag is_natives_code);
+
   // Create a shared function info object for a String source and a task that
   // has deserialized cached data on a background thread. The cached data from
   // the task may be rejected, in which case this function will set
@@ -587,6 +612,10 @@ struct ScriptStreamingData {
   ScriptStreamingData(
       std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
+  ScriptStreamingData(
+      std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream,
+      ScriptCompiler::StreamedSource::Encoding encoding,
+      std::vector<int> compile_hints);
   ScriptStreamingData(const ScriptStreamingData&) = delete;
   ScriptStreamingData& operator=(const ScriptStreamingData&) = delete;
   ~ScriptStreamingData();
@@ -597,6 +626,9 @@ struct ScriptStreamingData {
   std::unique_ptr<ScriptCompiler::ExternalSourceStream> source_stream;
   ScriptCompiler::StreamedSource::Encoding encoding;
 
+  // Sorted source positions of the functions to compile eagerly.
+  std::vector<int> compile_hints;
+
   // Task that performs background parsing and compilation.
   std::unique_ptr<BackgroundCompileTask> task;
 };
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -36,6 +38,21 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
   delete job;
 }
 
+// Whether installing the result of {job} would be pointless. Must be called on
+// the main thread.
+bool IsObsoleteCompilationJob(OptimizedCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // OSR code is not installed on the function and is kept regardless. Stress
+  // testing jobs are meant to run to completion.
+  if (info->is_osr() || info->discard_result_for_testing()) return false;
+  Handle<JSFunction> function = info->closure();
+  if (function->HasAvailableCodeKind(info->code_kind())) return true;
+  // Somebody (e.g. a deoptimization or a synchronous compile) reset the
+  // marker, so the function no longer waits for this job.
+  return CodeKindIsStoredInOptimizedCodeCache(info->code_kind()) &&
+         !function->IsInOptimizationQueue();
+}
+
 }  // namespace
 
 class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
@@ -99,19 +116,39 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
 
 OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   DCHECK_EQ(0, ref_count_);
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
-  base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-  DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
-  return job;
+  InputQueueEntry entry;
+  {
+    base::MutexGuard access_input_queue_(&input_queue_mutex_);
+    if (input_queue_.empty()) return nullptr;
+    std::pop_heap(input_queue_.begin(), input_queue_.end(),
+                  InputQueueEntryLess());
+    entry = input_queue_.back();
+    input_queue_.pop_back();
+  }
+  DCHECK_NOT_NULL(entry.job);
+  isolate_->counters()
+      ->turbofan_optimize_concurrent_queue_wait()
+      ->AddTimedSample(base::TimeTicks::Now() - entry.enqueue_time);
+  return entry.job;
+}
+
+double OptimizingCompileDispatcher::ComputePriority(
+    OptimizedCompilationJob* job, base::TimeTicks enqueue_time) const {
+  if (!FLAG_concurrent_recompilation_prioritize) return 0;
+  Handle<JSFunction> function = job->compilation_info()->closure();
+  double hotness = function->has_feedback_vector()
+                       ? function->feedback_vector().invocation_count()
+                       : 0;
+  // A job that has waited for {t} ms is treated as if its function had been
+  // invoked {t * ageing_rate} more times. As this bonus grows equally for all
+  // waiting jobs, subtracting it at enqueue time yields the same order.
+  double enqueue_ms = (enqueue_time - base::TimeTicks()).InMillisecondsF();
+  return hotness - FLAG_concurrent_recompilation_ageing_rate * enqueue_ms;
 }
 
 void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
@@ -150,13 +187,47 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  while (input_queue_length_ > 0) {
-    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    input_queue_shift_ = InputQueueIndex(1);
-    input_queue_length_--;
-    DisposeCompilationJob(job, true);
+  for (const InputQueueEntry& entry : input_queue_) {
+    DCHECK_NOT_NULL(entry.job);
+    DisposeCompilationJob(entry.job, true);
+  }
+  input_queue_.clear();
+}
+
+int OptimizingCompileDispatcher::CancelObsoleteJobs() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  HandleScope handle_scope(isolate_);
+  std::vector<OptimizedCompilationJob*> cancelled;
+  {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    auto it = std::remove_if(
+        input_queue_.begin(), input_queue_.end(),
+        [&cancelled](const InputQueueEntry& entry) {
+          if (!IsObsoleteCompilationJob(entry.job)) return false;
+          cancelled.push_back(entry.job);
+          return true;
+        });
+    if (it == input_queue_.end()) return 0;
+    input_queue_.erase(it, input_queue_.end());
+    std::make_heap(input_queue_.begin(), input_queue_.end(),
+                   InputQueueEntryLess());
+  }
+
+  // The compile tasks posted for the cancelled jobs find fewer entries in the
+  // input queue and simply return.
+  for (OptimizedCompilationJob* job : cancelled) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Cancelling obsolete compilation of ");
+      job->compilation_info()->closure()->ShortPrint();
+      PrintF(".\n");
+    }
+    isolate_->counters()
+        ->concurrent_recompilation_jobs_cancelled()
+        ->Increment();
+    // The function's code and marker already reflect its current state.
+    DisposeCompilationJob(job, false);
   }
+  return static_cast<int>(cancelled.size());
 }
 
 void OptimizingCompileDispatcher::AwaitCompileTasks() {
@@ -167,7 +238,7 @@ void OptimizingCompileDispatcher::AwaitCompileTasks() {
 
 #ifdef DEBUG
   base::MutexGuard access_input_queue(&input_queue_mutex_);
-  CHECK_EQ(input_queue_length_, 0);
+  CHECK(input_queue_.empty());
 #endif  // DEBUG
 }
 
@@ -195,12 +266,13 @@ void OptimizingCompileDispatcher::Stop() {
   HandleScope handle_scope(isolate_);
   FlushQueues(BlockingBehavior::kBlock, false);
   // At this point the optimizing compiler thread's event loop has stopped.
-  // There is no need for a mutex when reading input_queue_length_.
-  DCHECK_EQ(input_queue_length_, 0);
+  // There is no need for a mutex when reading input_queue_.
+  DCHECK(input_queue_.empty());
 }
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
+  CancelObsoleteJobs();
 
   for (;;) {
     OptimizedCompilationJob* job = nullptr;
@@ -236,16 +308,26 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
-  {
-    // Add job to the back of the input queue.
-    base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
-  }
+  AddToInputQueue(job, base::TimeTicks::Now());
   V8::GetCurrentPlatform()->CallOnWorkerThread(
       std::make_unique<CompileTask>(isolate_, this));
 }
 
+void OptimizingCompileDispatcher::AddToInputQueue(
+    OptimizedCompilationJob* job, base::TimeTicks enqueue_time) {
+  // Without prioritization, entries only differ in their sequence number, so
+  // the queue is strictly FIFO.
+  bool is_osr = FLAG_concurrent_recompilation_prioritize &&
+                job->compilation_info()->is_osr();
+  InputQueueEntry entry{job, is_osr, ComputePriority(job, enqueue_time), 0,
+                        enqueue_time};
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  DCHECK_LT(static_cast<int>(input_queue_.size()), input_queue_capacity_);
+  entry.sequence = input_queue_sequence_++;
+  input_queue_.push_back(entry);
+  std::push_heap(input_queue_.begin(), input_queue_.end(),
+                 InputQueueEntryLess());
+}
+
 }  // namespace internal
 }  // namespace v8
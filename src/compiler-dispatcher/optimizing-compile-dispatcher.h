@@ -7,13 +7,16 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -28,11 +31,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   explicit OptimizingCompileDispatcher(Isolate* isolate)
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_.reserve(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -46,9 +47,15 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return static_cast<int>(input_queue_.size()) < input_queue_capacity_;
   }
 
+  // Removes jobs from the input queue whose result would be thrown away on
+  // installation, e.g. because the function got optimized in the meantime or
+  // its optimization marker was reset. Returns the number of cancelled jobs.
+  // This method must be called on the main thread.
+  int CancelObsoleteJobs();
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
   // This method must be called on the main thread.
@@ -68,27 +75,56 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  FRIEND_TEST(OptimizingCompileDispatcherTest, HotterJobsGoFirst);
+  FRIEND_TEST(OptimizingCompileDispatcherTest, AgeingLetsOlderJobsWin);
+  FRIEND_TEST(OptimizingCompileDispatcherTest, FifoWithoutPrioritization);
+  FRIEND_TEST(OptimizingCompileDispatcherTest, CancelObsoleteJobs);
+
+  // An entry of the input queue. Entries are kept in a max-heap ordered by
+  // {priority}, which is the hotness of the function at enqueue time with a
+  // bonus for the time spent waiting (see ComputePriority). Because the bonus
+  // grows at the same rate for all entries, the priority is fixed at enqueue
+  // time and the heap never needs to be rebalanced.
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    // Only set for OSR jobs if prioritization is enabled.
+    bool is_osr;
+    double priority;
+    // Monotonically increasing, used to keep FIFO order among equal
+    // priorities.
+    uint64_t sequence;
+    base::TimeTicks enqueue_time;
+  };
+
+  struct InputQueueEntryLess {
+    bool operator()(const InputQueueEntry& a, const InputQueueEntry& b) const {
+      // OSR jobs block a function that is stuck in a hot loop, so they always
+      // go first.
+      if (a.is_osr != b.is_osr) return b.is_osr;
+      if (a.priority != b.priority) return a.priority < b.priority;
+      return a.sequence > b.sequence;
+    }
+  };
+
   void FlushQueues(BlockingBehavior blocking_behavior,
                    bool restore_function_code);
   void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
-
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  // Adds {job} to the input queue without posting a task to compile it.
+  void AddToInputQueue(OptimizedCompilationJob* job,
+                       base::TimeTicks enqueue_time);
+  double ComputePriority(OptimizedCompilationJob* job,
+                         base::TimeTicks enqueue_time) const;
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  // Priority queue of incoming recompilation tasks (including OSR), stored as
+  // a heap with the highest priority job at the front.
+  std::vector<InputQueueEntry> input_queue_;
   int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
+  uint64_t input_queue_sequence_ = 0;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
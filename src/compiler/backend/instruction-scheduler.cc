@@ -24,6 +24,15 @@ void InstructionScheduler::SchedulingQueueBase::AddNode(
   nodes_.insert(it, node);
 }
 
+int InstructionScheduler::SchedulingQueueBase::EarliestStartCycle() const {
+  DCHECK(!IsEmpty());
+  int earliest = nodes_.front()->start_cycle();
+  for (ScheduleGraphNode* node : nodes_) {
+    earliest = std::min(earliest, node->start_cycle());
+  }
+  return earliest;
+}
+
 InstructionScheduler::ScheduleGraphNode*
 InstructionScheduler::CriticalPathFirstQueue::PopBestCandidate(int cycle) {
   DCHECK(!IsEmpty());
@@ -239,6 +248,12 @@ void InstructionScheduler::Schedule() {
           ready_list.AddNode(successor);
         }
       }
+    } else {
+      // Nothing can be issued before the operands of one of the ready nodes
+      // are available, so skip the idle cycles in between instead of
+      // scanning the ready list once per cycle. This matters for long
+      // latency instructions like divisions.
+      cycle = ready_list.EarliestStartCycle() - 1;
     }
 
     cycle++;
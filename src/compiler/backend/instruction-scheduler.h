@@ -112,6 +112,10 @@ class InstructionScheduler final : public ZoneObject {
 
     bool IsEmpty() const { return nodes_.empty(); }
 
+    // The first cycle at which the operands of one of the queued nodes are
+    // available.
+    int EarliestStartCycle() const;
+
    protected:
     InstructionScheduler* scheduler_;
     ZoneLinkedList<ScheduleGraphNode*> nodes_;
@@ -2646,6 +2646,101 @@ void BundleBuilder::BuildBundles() {
     }
     TRACE("Done block B%d\n", block_id);
   }
+  if (data()->is_loop_aware_alloc()) CoalesceCopies();
+}
+
+void BundleBuilder::CoalesceCopies() {
+  TRACE("Coalesce copies\n");
+  int coalesced = 0;
+  for (Instruction* instr : code()->instructions()) {
+    for (int i = Instruction::FIRST_GAP_POSITION;
+         i <= Instruction::LAST_GAP_POSITION; ++i) {
+      ParallelMove* moves =
+          instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+      if (moves == nullptr) continue;
+      for (MoveOperands* move : *moves) {
+        if (move->IsEliminated()) continue;
+        if (!move->source().IsUnallocated()) continue;
+        if (!move->destination().IsUnallocated()) continue;
+        int from = UnallocatedOperand::cast(move->source()).virtual_register();
+        int to =
+            UnallocatedOperand::cast(move->destination()).virtual_register();
+        if (from == to) continue;
+        if (TryCoalesce(data()->GetOrCreateLiveRangeFor(from),
+                        data()->GetOrCreateLiveRangeFor(to))) {
+          TRACE("Coalesced v%d and v%d\n", from, to);
+          ++coalesced;
+        }
+      }
+    }
+  }
+  TRACE("Coalesced %d copies\n", coalesced);
+}
+
+bool BundleBuilder::TryCoalesce(LiveRange* from, LiveRange* to) {
+  if (from->representation() != to->representation()) return false;
+  LiveRangeBundle* from_bundle = from->get_bundle();
+  LiveRangeBundle* to_bundle = to->get_bundle();
+  if (from_bundle != nullptr && from_bundle == to_bundle) return false;
+  if (from_bundle == nullptr && to_bundle == nullptr) {
+    to_bundle = data()->allocation_zone()->New<LiveRangeBundle>(
+        data()->allocation_zone(), next_bundle_id_++);
+    to_bundle->TryAddRange(to);
+  }
+  if (from_bundle == nullptr) return to_bundle->TryAddRange(from);
+  if (to_bundle == nullptr) return from_bundle->TryAddRange(to);
+  return LiveRangeBundle::TryMerge(to_bundle, from_bundle,
+                                   data()->is_trace_alloc()) != nullptr;
+}
+
+void LoopRangeSplitter::SplitRangesAroundLoops() {
+  TRACE("Split ranges around loops\n");
+  struct LoopBounds {
+    LifetimePosition start;
+    LifetimePosition end;
+  };
+  // Loops are contiguous in the instruction order, so a loop covers the
+  // positions from the start of its header up to the start of the first block
+  // after it. Outer loops come before the loops nested in them.
+  ZoneVector<LoopBounds> loops(data()->allocation_zone());
+  for (const InstructionBlock* block : code()->instruction_blocks()) {
+    if (!block->IsLoopHeader() || block->IsDeferred()) continue;
+    int end_index = block->loop_end().ToInt() < code()->InstructionBlockCount()
+                        ? code()
+                              ->InstructionBlockAt(block->loop_end())
+                              ->first_instruction_index()
+                        : code()->LastInstructionIndex() + 1;
+    loops.push_back(
+        {LifetimePosition::GapFromInstructionIndex(
+             block->first_instruction_index()),
+         LifetimePosition::GapFromInstructionIndex(end_index)});
+  }
+  if (loops.empty()) return;
+
+  int split_ranges = 0;
+  for (TopLevelLiveRange* range : data()->live_ranges()) {
+    if (range == nullptr || range->IsEmpty() || range->HasSpillOperand()) {
+      continue;
+    }
+    LiveRange* current = range;
+    for (const LoopBounds& loop : loops) {
+      if (loop.start <= current->Start()) continue;
+      if (current->End() <= loop.start) break;
+      if (!current->Covers(loop.start)) continue;
+      UsePosition* use = current->NextUsePosition(loop.start);
+      if (use != nullptr && use->pos() < loop.end) continue;
+      TRACE("Splitting v%d around loop [%d, %d[\n", range->vreg(),
+            loop.start.value(), loop.end.value());
+      LiveRange* inside =
+          current->SplitAt(loop.start, data()->allocation_zone());
+      ++split_ranges;
+      // Loops nested in this one are covered by {inside} as well, and are
+      // skipped because they start before the remainder of the range.
+      if (inside->End() <= loop.end) break;
+      current = inside->SplitAt(loop.end, data()->allocation_zone());
+    }
+  }
+  TRACE("Split %d ranges around loops\n", split_ranges);
 }
 
 bool LiveRangeBundle::TryAddRange(LiveRange* range) {
@@ -175,7 +175,10 @@ class LifetimePosition final {
 
 std::ostream& operator<<(std::ostream& os, const LifetimePosition pos);
 
-enum class RegisterAllocationFlag : unsigned { kTraceAllocation = 1 << 0 };
+enum class RegisterAllocationFlag : unsigned {
+  kTraceAllocation = 1 << 0,
+  kLoopAwareAllocation = 1 << 1
+};
 
 using RegisterAllocationFlags = base::Flags<RegisterAllocationFlag>;
 
@@ -214,6 +217,10 @@ class TopTierRegisterAllocationData final : public RegisterAllocationData {
     return flags_ & RegisterAllocationFlag::kTraceAllocation;
   }
 
+  bool is_loop_aware_alloc() {
+    return flags_ & RegisterAllocationFlag::kLoopAwareAllocation;
+  }
+
   static constexpr int kNumberOfFixedRangesPerRegister = 2;
 
   class PhiMapValue : public ZoneObject {
@@ -1286,12 +1293,35 @@ class BundleBuilder final : public ZoneObject {
   void BuildBundles();
 
  private:
+  // Puts the source and destination of gap moves between virtual registers
+  // into the same bundle where their live ranges do not overlap, so that they
+  // get the same register hint and share a spill slot.
+  void CoalesceCopies();
+  bool TryCoalesce(LiveRange* from, LiveRange* to);
+
   TopTierRegisterAllocationData* data() const { return data_; }
   InstructionSequence* code() const { return data_->code(); }
   TopTierRegisterAllocationData* data_;
   int next_bundle_id_ = 0;
 };
 
+// Splits live ranges that are live across a loop without being used inside of
+// it at the loop boundaries. The linear scan allocator can then spill the child
+// covering the loop as a whole, which places the spill and the reload outside
+// of the loop instead of at an arbitrary position inside of it.
+class LoopRangeSplitter final : public ZoneObject {
+ public:
+  explicit LoopRangeSplitter(TopTierRegisterAllocationData* data)
+      : data_(data) {}
+
+  void SplitRangesAroundLoops();
+
+ private:
+  TopTierRegisterAllocationData* data() const { return data_; }
+  InstructionSequence* code() const { return data_->code(); }
+  TopTierRegisterAllocationData* data_;
+};
+
 class RegisterAllocator : public ZoneObject {
  public:
   RegisterAllocator(TopTierRegisterAllocationData* data, RegisterKind kind);
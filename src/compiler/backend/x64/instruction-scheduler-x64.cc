@@ -2,7 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
@@ -439,9 +444,36 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+namespace {
+
+// Approximate latencies, in cycles, of the instruction classes that the
+// scheduler distinguishes. Instructions not covered here take one cycle.
+struct X64Latencies {
+  int load;  // L1 hit, added to every instruction that reads memory.
+  int imul;
+  int idiv64;
+  int idiv32;
+  int udiv64;
+  int udiv32;
+  int fp_add;  // Also compares, min/max and float width conversions.
+  int fp_mul;
+  int fp_div32;
+  int fp_div64;
+  int fp_sqrt32;
+  int fp_sqrt64;
+  int fp_round;
+  int fp_to_int;
+  int int_to_fp;
+  int fp_mod;
+  int simd_int_mul;
+  int simd_shuffle;
+  int truncate_double_to_i;
+};
+
+// The empirically determined latencies the scheduler used before it knew
+// about microarchitectures. Used when we don't recognize the CPU, and for
+// reproducible code (--predictable, e.g. builtins generated by mksnapshot).
+int GenericLatency(const Instruction* instr) {
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
       return 5;
@@ -499,6 +531,245 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   }
 }
 
+// Intel Core (family 6, Sandy Bridge and later).
+constexpr X64Latencies kIntelCoreLatencies = {
+    /* load */ 5,      /* imul */ 3,       /* idiv64 */ 42,
+    /* idiv32 */ 26,   /* udiv64 */ 35,    /* udiv32 */ 26,
+    /* fp_add */ 4,    /* fp_mul */ 4,     /* fp_div32 */ 11,
+    /* fp_div64 */ 14, /* fp_sqrt32 */ 12, /* fp_sqrt64 */ 18,
+    /* fp_round */ 8,  /* fp_to_int */ 6,  /* int_to_fp */ 5,
+    /* fp_mod */ 50,   /* simd_int_mul */ 10, /* simd_shuffle */ 1,
+    /* truncate_double_to_i */ 6};
+
+// Intel Atom (Silvermont and later).
+constexpr X64Latencies kIntelAtomLatencies = {
+    /* load */ 3,      /* imul */ 5,       /* idiv64 */ 70,
+    /* idiv32 */ 30,   /* udiv64 */ 60,    /* udiv32 */ 25,
+    /* fp_add */ 3,    /* fp_mul */ 5,     /* fp_div32 */ 19,
+    /* fp_div64 */ 34, /* fp_sqrt32 */ 19, /* fp_sqrt64 */ 34,
+    /* fp_round */ 4,  /* fp_to_int */ 5,  /* int_to_fp */ 6,
+    /* fp_mod */ 80,   /* simd_int_mul */ 11, /* simd_shuffle */ 1,
+    /* truncate_double_to_i */ 8};
+
+// AMD Zen (family 17h and later).
+constexpr X64Latencies kAmdZenLatencies = {
+    /* load */ 4,      /* imul */ 3,       /* idiv64 */ 40,
+    /* idiv32 */ 25,   /* udiv64 */ 40,    /* udiv32 */ 25,
+    /* fp_add */ 3,    /* fp_mul */ 3,     /* fp_div32 */ 10,
+    /* fp_div64 */ 13, /* fp_sqrt32 */ 14, /* fp_sqrt64 */ 20,
+    /* fp_round */ 3,  /* fp_to_int */ 7,  /* int_to_fp */ 7,
+    /* fp_mod */ 50,   /* simd_int_mul */ 4, /* simd_shuffle */ 1,
+    /* truncate_double_to_i */ 7};
+
+const X64Latencies* SelectLatencies() {
+  if (strcmp(FLAG_mcpu, "auto") != 0) {
+    if (strcmp(FLAG_mcpu, "atom") == 0) return &kIntelAtomLatencies;
+    if (strcmp(FLAG_mcpu, "core") == 0) return &kIntelCoreLatencies;
+    if (strcmp(FLAG_mcpu, "zen") == 0) return &kAmdZenLatencies;
+    return nullptr;
+  }
+  if (FLAG_predictable) return nullptr;
+  base::CPU cpu;
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0) {
+    if (cpu.is_atom()) return &kIntelAtomLatencies;
+    if (cpu.family() == 0x6) return &kIntelCoreLatencies;
+  } else if (strcmp(cpu.vendor(), "AuthenticAMD") == 0) {
+    if (cpu.family() == 0xF && cpu.ext_family() >= 0x8) {
+      return &kAmdZenLatencies;
+    }
+  }
+  return nullptr;
+}
+
+// Returns nullptr if the generic latencies are to be used.
+const X64Latencies* Latencies() {
+  static const X64Latencies* latencies = SelectLatencies();
+  return latencies;
+}
+
+// Whether {instr} reads one of its operands from memory.
+bool ReadsMemory(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+#define CASE(Name) case k##Name:
+    COMMON_ARCH_OPCODE_LIST(CASE)
+#undef CASE
+    case kX64Lea:
+    case kX64Lea32:
+      return false;
+    case kX64Cmp:
+    case kX64Cmp32:
+    case kX64Cmp16:
+    case kX64Cmp8:
+    case kX64Test:
+    case kX64Test32:
+    case kX64Test16:
+    case kX64Test8:
+      return instr->addressing_mode() != kMode_None;
+    default:
+      // Everything else with a memory operand is either a load or a store.
+      return instr->addressing_mode() != kMode_None && instr->HasOutput();
+  }
+}
+
+// The latency of {instr} once all of its operands are in registers.
+int ExecutionLatency(const X64Latencies& latencies, const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kX64Movb:
+    case kX64Movw:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64Movss:
+    case kX64Movsd:
+    case kX64Movdqu:
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTaggedPointer:
+    case kX64MovqDecompressAnyTagged:
+    case kX64MovqCompressTagged:
+    case kX64S128Load8Splat:
+    case kX64S128Load16Splat:
+    case kX64S128Load32Splat:
+    case kX64S128Load64Splat:
+    case kX64S128Load8x8S:
+    case kX64S128Load8x8U:
+    case kX64S128Load16x4S:
+    case kX64S128Load16x4U:
+    case kX64S128Load32x2S:
+    case kX64S128Load32x2U:
+      // Loads only pay for the memory access.
+      return ReadsMemory(instr) ? 0 : 1;
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+      return latencies.imul;
+    case kX64Idiv:
+      return latencies.idiv64;
+    case kX64Idiv32:
+      return latencies.idiv32;
+    case kX64Udiv:
+      return latencies.udiv64;
+    case kX64Udiv32:
+      return latencies.udiv32;
+    case kX64Float32Abs:
+    case kX64Float32Neg:
+    case kX64Float64Abs:
+    case kX64Float64Neg:
+    case kSSEFloat32Cmp:
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kX64F32x4Add:
+    case kX64F32x4Sub:
+    case kX64F64x2Add:
+    case kX64F64x2Sub:
+      return latencies.fp_add;
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+    case kX64F32x4Mul:
+    case kX64F64x2Mul:
+    case kX64F32x4Qfma:
+    case kX64F32x4Qfms:
+    case kX64F64x2Qfma:
+    case kX64F64x2Qfms:
+      return latencies.fp_mul;
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+    case kX64F32x4Div:
+      return latencies.fp_div32;
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+    case kX64F64x2Div:
+      return latencies.fp_div64;
+    case kSSEFloat32Sqrt:
+    case kX64F32x4Sqrt:
+      return latencies.fp_sqrt32;
+    case kSSEFloat64Sqrt:
+    case kX64F64x2Sqrt:
+      return latencies.fp_sqrt64;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+    case kX64F32x4Round:
+    case kX64F64x2Round:
+      return latencies.fp_round;
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+      return latencies.fp_to_int;
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToUint64:
+    case kSSEFloat64ToUint64:
+      // These need a fixup sequence for out-of-range inputs.
+      return latencies.fp_to_int + 4;
+    case kSSEInt32ToFloat32:
+    case kSSEInt32ToFloat64:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint32ToFloat32:
+    case kSSEUint32ToFloat64:
+      return latencies.int_to_fp;
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+      return latencies.int_to_fp + 4;
+    case kSSEFloat64Mod:
+      return latencies.fp_mod;
+    case kX64I32x4Mul:
+    case kX64I16x8Mul:
+    case kX64I64x2Mul:
+    case kX64I32x4DotI16x8S:
+      return latencies.simd_int_mul;
+    case kX64I8x16Swizzle:
+    case kX64I8x16Shuffle:
+    case kX64Shufps:
+    case kX64S32x4Swizzle:
+    case kX64S32x4Shuffle:
+      return latencies.simd_shuffle;
+    case kArchTruncateDoubleToI:
+      return latencies.truncate_double_to_i;
+    default:
+      return 1;
+  }
+}
+
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  // The latency model is picked once per process: the one for the CPU we are
+  // running on (or the one requested with --mcpu), falling back to a generic
+  // model for unknown CPUs and for reproducible code generation.
+  const X64Latencies* latencies = Latencies();
+  if (latencies == nullptr) return GenericLatency(instr);
+  int latency = ExecutionLatency(*latencies, instr);
+  if (ReadsMemory(instr)) latency += latencies->load;
+  return std::max(latency, 1);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
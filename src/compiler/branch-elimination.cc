@@ -36,6 +36,8 @@ Reduction BranchElimination::Reduce(Node* node) {
     case IrOpcode::kDeoptimizeIf:
     case IrOpcode::kDeoptimizeUnless:
       return ReduceDeoptimizeConditional(node);
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
     case IrOpcode::kMerge:
       return ReduceMerge(node);
     case IrOpcode::kLoop:
@@ -344,6 +346,64 @@ Reduction BranchElimination::ReduceDeoptimizeConditional(Node* node) {
                           false);
 }
 
+Reduction BranchElimination::ReduceCheckBounds(Node* node) {
+  DCHECK_EQ(IrOpcode::kCheckBounds, node->opcode());
+  // This relies on the typer, which has only run before simplified lowering.
+  if (!FLAG_turbo_loop_bounds_check_elimination || phase_ != kEARLY) {
+    return NoChange();
+  }
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* limit = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  if (!reduced_.Get(control)) return NoChange();
+
+  // The {index} must be a non-negative integer, e.g. the induction variable
+  // of a loop starting at zero as typed by the LoopVariableOptimizer.
+  Type const index_type = NodeProperties::GetType(index);
+  if (!index_type.Is(Type::Range(0.0, kMaxSafeInteger, graph()->zone()))) {
+    return NoChange();
+  }
+
+  // Look for a dominating {index < limit} check (or {limit <= index} being
+  // false), such as the condition of a loop over an array or a typed array.
+  ControlPathConditions conditions = node_conditions_.Get(control);
+  bool in_bounds = false;
+  for (Node* use : index->uses()) {
+    bool in_bounds_if;
+    switch (use->opcode()) {
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kSpeculativeNumberLessThan:
+        if (use->InputAt(0) != index || use->InputAt(1) != limit) continue;
+        in_bounds_if = true;
+        break;
+      case IrOpcode::kNumberLessThanOrEqual:
+      case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+        if (use->InputAt(0) != limit || use->InputAt(1) != index) continue;
+        in_bounds_if = false;
+        break;
+      default:
+        continue;
+    }
+    Node* branch;
+    bool condition_value;
+    if (conditions.LookupCondition(use, &branch, &condition_value) &&
+        condition_value == in_bounds_if) {
+      in_bounds = true;
+      break;
+    }
+  }
+  if (!in_bounds) return NoChange();
+
+  // Keep the type the check established for the uses of {node}.
+  Type const type = NodeProperties::GetType(node);
+  Node* guard = graph()->NewNode(common()->TypeGuard(type), index, effect,
+                                 control);
+  NodeProperties::SetType(guard, type);
+  ReplaceWithValue(node, guard, guard, control);
+  return Replace(guard);
+}
+
 Reduction BranchElimination::ReduceIf(Node* node, bool is_true_branch) {
   // Add the condition to the list arriving from the input branch.
   Node* branch = NodeProperties::GetControlInput(node, 0);
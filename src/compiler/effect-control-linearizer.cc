@@ -194,6 +194,8 @@ class EffectControlLinearizer {
   void LowerTransitionElementsKind(Node* node);
   Node* LowerLoadFieldByIndex(Node* node);
   Node* LowerLoadMessage(Node* node);
+  Node* AdaptFastCallStringArgument(Node* node, CTypeInfo::Type type,
+                                    GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
                                         GraphAssemblerLabel<0>* bailout);
@@ -4993,10 +4995,71 @@ MachineType MachineTypeFor(CTypeInfo::Type type) {
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
       return MachineType::AnyTagged();
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
+      return MachineType::Pointer();
+    case CTypeInfo::Type::kInt8:
+    case CTypeInfo::Type::kUint8:
+    case CTypeInfo::Type::kInt16:
+    case CTypeInfo::Type::kUint16:
+      UNREACHABLE();
   }
 }
 }  // namespace
 
+Node* EffectControlLinearizer::AdaptFastCallStringArgument(
+    Node* node, CTypeInfo::Type type, GraphAssemblerLabel<0>* bailout) {
+  // Only flat sequential strings with the expected encoding are passed to
+  // the fast callback. Everything else, including cons, sliced, thin and
+  // external strings, goes to the slow path.
+  __ GotoIf(ObjectIsSmi(node), bailout);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  const uint32_t expected_encoding = type == CTypeInfo::Type::kSeqOneByteString
+                                         ? kOneByteStringTag
+                                         : kTwoByteStringTag;
+  Node* value_is_expected_string = __ Word32Equal(
+      __ Word32And(value_instance_type,
+                   __ Int32Constant(kIsNotStringMask |
+                                    kStringRepresentationMask |
+                                    kStringEncodingMask)),
+      __ Int32Constant(kStringTag | kSeqStringTag | expected_encoding));
+  __ GotoIfNot(value_is_expected_string, bailout);
+
+  // The characters directly follow the header of both SeqOneByteString and
+  // SeqTwoByteString. Fast callbacks cannot trigger a GC, so the pointer
+  // stays valid for the duration of the call. The untagging is done with an
+  // UnsafePointerAdd so that it stays in the effect chain right before the
+  // call, after any potential allocation.
+  STATIC_ASSERT(SeqOneByteString::kHeaderSize == SeqTwoByteString::kHeaderSize);
+  Node* data_ptr = __ UnsafePointerAdd(
+      node, __ IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+
+  constexpr int kAlign = alignof(FastOneByteString);
+  constexpr int kSize = sizeof(FastOneByteString);
+  static_assert(kAlign == alignof(FastTwoByteString),
+                "Alignment mismatch between FastOneByteString and "
+                "FastTwoByteString");
+  static_assert(kSize == sizeof(FastTwoByteString),
+                "Size mismatch between FastOneByteString and "
+                "FastTwoByteString");
+  static_assert(offsetof(FastOneByteString, length) ==
+                    offsetof(FastTwoByteString, length),
+                "Layout mismatch between FastOneByteString and "
+                "FastTwoByteString");
+  Node* stack_slot = __ StackSlot(kSize, kAlign);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, data)),
+           data_ptr);
+  __ Store(StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, length)),
+           length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
     Node* node, ElementsKind expected_elements_kind,
     GraphAssemblerLabel<0>* bailout) {
@@ -5102,6 +5165,11 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
+        case CTypeInfo::Type::kSeqOneByteString:
+        case CTypeInfo::Type::kSeqTwoByteString: {
+          return AdaptFastCallStringArgument(node, arg_type.GetType(),
+                                             if_error);
+        }
         default: {
           return node;
         }
@@ -5341,8 +5409,12 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   MachineType return_type = MachineTypeFor(c_signature->ReturnInfo().GetType());
   builder.AddReturn(return_type);
   for (int i = 0; i < c_arg_count; ++i) {
+    CTypeInfo type = c_signature->ArgumentInfo(i);
+    // Sequences and TypedArrays are passed as a pointer to a stack slot.
     MachineType machine_type =
-        MachineTypeFor(c_signature->ArgumentInfo(i).GetType());
+        type.GetSequenceType() == CTypeInfo::SequenceType::kScalar
+            ? MachineTypeFor(type.GetType())
+            : MachineType::Pointer();
     builder.AddParam(machine_type);
   }
   if (c_signature->HasOptions()) {
@@ -5461,6 +5533,12 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       break;
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
+    case CTypeInfo::Type::kInt8:
+    case CTypeInfo::Type::kUint8:
+    case CTypeInfo::Type::kInt16:
+    case CTypeInfo::Type::kUint16:
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
       UNREACHABLE();
   }
 
@@ -4,6 +4,7 @@
 
 #include "src/compiler/escape-analysis.h"
 
+#include "src/base/small-vector.h"
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-matchers.h"
@@ -643,9 +644,6 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
         if (length == 1 &&
             vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
             current->Get(var).To(&value) &&
@@ -656,37 +654,52 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           // one element of {object}.
           current->SetReplacement(value);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
+        } else if (length >= 2 &&
+                   length <= FLAG_turbo_escape_max_dynamic_elements) {
+          // The {object} has only a few elements, so the LoadElement must
+          // return one of them. We can turn the LoadElement into a chain of
+          // Select operations instead (still allowing the {object} to be
+          // scalar replaced), which is what makes e.g. {arguments[i]} with a
+          // dynamic {i} cheap for small arguments objects. We must however
+          // mark the elements of the {object} itself as escaping.
+          base::SmallVector<Node*, 8> values(length);
+          bool known_values = true;
+          bool all_values_set = true;
+          for (int i = 0; i < length; ++i) {
+            if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+                !current->Get(var).To(&value) ||
+                (value != nullptr &&
+                 !NodeProperties::GetType(value).Is(access.type))) {
+              known_values = false;
+              break;
+            }
+            if (value == nullptr) all_values_set = false;
+            values[i] = value;
+          }
+          if (known_values) {
+            if (!all_values_set) {
+              // If the variables have no values, we have
+              // not reached the fixed-point yet.
+              break;
+            }
+            Node* select = values[length - 1];
+            for (int i = length - 2; i >= 0; --i) {
+              Node* constant = jsgraph->Constant(i);
+              if (!NodeProperties::IsTyped(constant)) {
+                NodeProperties::SetType(
+                    constant, Type::Range(i, i, jsgraph->graph()->zone()));
+              }
+              Node* check = jsgraph->graph()->NewNode(
+                  jsgraph->simplified()->NumberEqual(), index, constant);
+              NodeProperties::SetType(check, Type::Boolean());
+              select = jsgraph->graph()->NewNode(
+                  jsgraph->common()->Select(
+                      access.machine_type.representation()),
+                  check, values[i], select);
+              NodeProperties::SetType(select, access.type);
+            }
             current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
+            for (Node* element : values) current->SetEscaped(element);
             break;
           }
         }
@@ -785,7 +798,13 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           current->SetReplacement(checked);
           break;
         default:
-          current->SetEscaped(checked);
+          // Virtual objects, e.g. behind a TypeGuard, are always allocations
+          // and thus heap objects.
+          if (current->GetVirtualObject(checked)) {
+            current->SetReplacement(checked);
+          } else {
+            current->SetEscaped(checked);
+          }
           break;
       }
       break;
@@ -11,6 +11,14 @@ namespace fast_api_call {
 
 ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
   switch (type) {
+    case CTypeInfo::Type::kInt8:
+      return INT8_ELEMENTS;
+    case CTypeInfo::Type::kUint8:
+      return UINT8_ELEMENTS;
+    case CTypeInfo::Type::kInt16:
+      return INT16_ELEMENTS;
+    case CTypeInfo::Type::kUint16:
+      return UINT16_ELEMENTS;
     case CTypeInfo::Type::kInt32:
       return INT32_ELEMENTS;
     case CTypeInfo::Type::kUint32:
@@ -27,6 +35,8 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
     case CTypeInfo::Type::kBool:
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
       UNREACHABLE();
   }
 }
@@ -247,6 +247,11 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     return NoChange();
   }
 
+  if (candidate.frequency.IsKnown()) {
+    candidate.score =
+        ComputeScore(candidate.frequency.value(), candidate.total_size);
+  }
+
   // Found a candidate. Insert it into the set of seen nodes s.t. we don't
   // revisit in the future. Note this insertion happens here and not earlier in
   // order to make inlining decisions order-independent. A node may not be a
@@ -779,6 +784,12 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   return Replace(value);
 }
 
+// static
+double JSInliningHeuristic::ComputeScore(double frequency, int total_size) {
+  if (!FLAG_turbo_inlining_benefit_per_byte) return frequency;
+  return frequency / std::max(total_size, 1);
+}
+
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
   if (right.frequency.IsUnknown()) {
@@ -791,9 +802,9 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
     return true;
   } else if (left.frequency.IsUnknown()) {
     return false;
-  } else if (left.frequency.value() > right.frequency.value()) {
+  } else if (left.score > right.score) {
     return true;
-  } else if (left.frequency.value() < right.frequency.value()) {
+  } else if (left.score < right.score) {
     return false;
   } else {
     return left.node->id() > right.node->id();
@@ -805,8 +816,11 @@ void JSInliningHeuristic::PrintCandidates() {
   os << candidates_.size() << " candidate(s) for inlining:" << std::endl;
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
-       << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << candidate.node->id() << " with frequency " << candidate.frequency;
+    if (FLAG_turbo_inlining_benefit_per_byte && candidate.frequency.IsKnown()) {
+      os << " (" << candidate.score << " per byte)";
+    }
+    os << ", " << candidate.num_functions << " target(s):" << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared = candidate.functions[i].has_value()
                                          ? candidate.functions[i]->shared()
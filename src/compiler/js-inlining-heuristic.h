@@ -47,6 +47,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
   }
 
  private:
+  friend class JSInliningHeuristicTest;
+
   // This limit currently matches what the old compiler did. We may want to
   // re-evaluate and come up with a proper limit for TurboFan.
   static const int kMaxCallPolymorphism = 4;
@@ -68,6 +70,12 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // The key candidates are ranked by, only meaningful if {frequency} is
+    // known. Either the frequency itself, or with
+    // --turbo-inlining-benefit-per-byte the frequency per byte of bytecode
+    // that inlining would add, so that the cumulative budget is spent on the
+    // call sites that promise the most benefit for their size.
+    double score = 0.0;
   };
 
   // Comparator for candidates.
@@ -79,6 +87,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
   using Candidates = ZoneSet<Candidate, CandidateCompare>;
 
   static int ScaleInliningSize(int value, JSHeapBroker* broker);
+  // Computes the {score} of a candidate with a known {frequency}.
+  static double ComputeScore(double frequency, int total_size);
 
   // Dumps candidates to console.
   void PrintCandidates();
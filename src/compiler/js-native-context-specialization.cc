@@ -1089,7 +1089,7 @@ Reduction JSNativeContextSpecialization::ReduceMinimorphicPropertyAccess(
 
 Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     Node* node, Node* value, NamedAccessFeedback const& feedback,
-    AccessMode access_mode, Node* key) {
+    FeedbackSource const& source, AccessMode access_mode, Node* key) {
   DCHECK(node->opcode() == IrOpcode::kJSLoadNamed ||
          node->opcode() == IrOpcode::kJSStoreNamed ||
          node->opcode() == IrOpcode::kJSLoadProperty ||
@@ -1191,6 +1191,11 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
 
   PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
 
+  // Attribute failing map checks to this access site, so that the deoptimizer
+  // can generalize its feedback if the site keeps deoptimizing.
+  FeedbackSource const map_check_feedback =
+      FLAG_deopt_generalize_feedback ? source : FeedbackSource();
+
   // Check for the monomorphic cases.
   if (access_infos.size() == 1) {
     PropertyAccessInfo access_info = access_infos.front();
@@ -1199,7 +1204,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
       // null. It can't be a number, a string etc. So trying to build the
       // checks in the "else if" branch doesn't make sense.
       access_builder.BuildCheckMaps(lookup_start_object, &effect, control,
-                                    access_info.lookup_start_object_maps());
+                                    access_info.lookup_start_object_maps(),
+                                    map_check_feedback);
 
     } else if (!access_builder.TryBuildStringCheck(
                    broker(), access_info.lookup_start_object_maps(), &receiver,
@@ -1226,14 +1232,16 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
         Control if_false{graph()->NewNode(common()->IfFalse(), branch)};
         Effect efalse = effect;
         access_builder.BuildCheckMaps(receiver, &efalse, if_false,
-                                      access_info.lookup_start_object_maps());
+                                      access_info.lookup_start_object_maps(),
+                                      map_check_feedback);
 
         control = graph()->NewNode(common()->Merge(2), if_true, if_false);
         effect =
             graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
       } else {
         access_builder.BuildCheckMaps(receiver, &effect, control,
-                                      access_info.lookup_start_object_maps());
+                                      access_info.lookup_start_object_maps(),
+                                      map_check_feedback);
       }
     } else {
       // At least one of TryBuildStringCheck & TryBuildNumberCheck succeeded
@@ -1310,7 +1318,8 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
           // Last map check on the fallthrough control path, do a
           // conditional eager deoptimization exit here.
           access_builder.BuildCheckMaps(lookup_start_object, &this_effect,
-                                        this_control, lookup_start_object_maps);
+                                        this_control, lookup_start_object_maps,
+                                        map_check_feedback);
           fallthrough_control = nullptr;
 
           // Don't insert a MapGuard in this case, as the CheckMaps
@@ -1996,7 +2005,7 @@ Reduction JSNativeContextSpecialization::ReducePropertyAccess(
           node,
           DeoptimizeReason::kInsufficientTypeFeedbackForGenericNamedAccess);
     case ProcessedFeedback::kNamedAccess:
-      return ReduceNamedAccess(node, value, feedback.AsNamedAccess(),
+      return ReduceNamedAccess(node, value, feedback.AsNamedAccess(), source,
                                access_mode, key);
     case ProcessedFeedback::kMinimorphicPropertyAccess:
       DCHECK_EQ(access_mode, AccessMode::kLoad);
@@ -106,6 +106,7 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
                                  AccessMode access_mode);
   Reduction ReduceNamedAccess(Node* node, Node* value,
                               NamedAccessFeedback const& feedback,
+                              FeedbackSource const& source,
                               AccessMode access_mode, Node* key = nullptr);
   Reduction ReduceMinimorphicPropertyAccess(
       Node* node, Node* value,
@@ -2256,6 +2256,15 @@ struct BuildBundlesPhase {
   }
 };
 
+struct SplitRangesAroundLoopsPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(SplitRangesAroundLoops)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopRangeSplitter splitter(data->top_tier_register_allocation_data());
+    splitter.SplitRangesAroundLoops();
+  }
+};
+
 template <typename RegAllocator>
 struct AllocateGeneralRegistersPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(AllocateGeneralRegisters)
@@ -3813,12 +3822,21 @@ void PipelineImpl::AllocateRegistersForTopTier(
   if (data->info()->trace_turbo_allocation()) {
     flags |= RegisterAllocationFlag::kTraceAllocation;
   }
+  bool loop_aware_allocation = data->info()->IsWasm()
+                                   ? FLAG_wasm_loop_aware_regalloc
+                                   : FLAG_turbo_loop_aware_regalloc;
+  if (loop_aware_allocation) {
+    flags |= RegisterAllocationFlag::kLoopAwareAllocation;
+  }
   data->InitializeTopTierRegisterAllocationData(config, call_descriptor, flags);
 
   Run<MeetRegisterConstraintsPhase>();
   Run<ResolvePhisPhase>();
   Run<BuildLiveRangesPhase>();
   Run<BuildBundlesPhase>();
+  if (loop_aware_allocation) {
+    Run<SplitRangesAroundLoopsPhase>();
+  }
 
   TraceSequence(info(), data, "before register allocation");
   if (verifier != nullptr) {
@@ -83,7 +83,8 @@ bool PropertyAccessBuilder::TryBuildNumberCheck(JSHeapBroker* broker,
 
 void PropertyAccessBuilder::BuildCheckMaps(Node* object, Effect* effect,
                                            Control control,
-                                           ZoneVector<MapRef> const& maps) {
+                                           ZoneVector<MapRef> const& maps,
+                                           FeedbackSource const& feedback) {
   HeapObjectMatcher m(object);
   if (m.HasResolvedValue()) {
     MapRef object_map = m.Ref(broker()).map();
@@ -104,8 +105,8 @@ void PropertyAccessBuilder::BuildCheckMaps(Node* object, Effect* effect,
       flags |= CheckMapsFlag::kTryMigrateInstance;
     }
   }
-  *effect = graph()->NewNode(simplified()->CheckMaps(flags, map_set), object,
-                             *effect, control);
+  *effect = graph()->NewNode(simplified()->CheckMaps(flags, map_set, feedback),
+                             object, *effect, control);
 }
 
 Node* PropertyAccessBuilder::BuildCheckValue(Node* receiver, Effect* effect,
@@ -42,8 +42,10 @@ class PropertyAccessBuilder {
   bool TryBuildNumberCheck(JSHeapBroker* broker, ZoneVector<MapRef> const& maps,
                            Node** receiver, Effect* effect, Control control);
 
+  // The {feedback} is attributed to the map check's deoptimization exit.
   void BuildCheckMaps(Node* object, Effect* effect, Control control,
-                      ZoneVector<MapRef> const& maps);
+                      ZoneVector<MapRef> const& maps,
+                      FeedbackSource const& feedback = FeedbackSource());
 
   Node* BuildCheckValue(Node* receiver, Effect* effect, Control control,
                         Handle<HeapObject> value);
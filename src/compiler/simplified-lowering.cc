@@ -1825,7 +1825,14 @@ class RepresentationSelector {
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
           case CTypeInfo::Type::kApiObject:
+          case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
             return UseInfo::AnyTagged();
+          case CTypeInfo::Type::kInt8:
+          case CTypeInfo::Type::kUint8:
+          case CTypeInfo::Type::kInt16:
+          case CTypeInfo::Type::kUint16:
+            UNREACHABLE();
         }
       }
       case CTypeInfo::SequenceType::kIsSequence: {
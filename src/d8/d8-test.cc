@@ -237,9 +237,25 @@ class FastCApiObject {
     size_t length = typed_array_arg->Length();
 
     void* data = typed_array_arg->Buffer()->GetBackingStore()->Data();
-    if (typed_array_arg->IsInt32Array() || typed_array_arg->IsUint32Array() ||
-        typed_array_arg->IsBigInt64Array() ||
-        typed_array_arg->IsBigUint64Array()) {
+    if (typed_array_arg->IsInt8Array() || typed_array_arg->IsUint8Array() ||
+        typed_array_arg->IsInt16Array() || typed_array_arg->IsUint16Array()) {
+      int32_t sum = 0;
+      for (unsigned i = 0; i < length; ++i) {
+        if (typed_array_arg->IsInt8Array()) {
+          sum += static_cast<int8_t*>(data)[i];
+        } else if (typed_array_arg->IsUint8Array()) {
+          sum += static_cast<uint8_t*>(data)[i];
+        } else if (typed_array_arg->IsInt16Array()) {
+          sum += static_cast<int16_t*>(data)[i];
+        } else if (typed_array_arg->IsUint16Array()) {
+          sum += static_cast<uint16_t*>(data)[i];
+        }
+      }
+      args.GetReturnValue().Set(Number::New(isolate, sum));
+    } else if (typed_array_arg->IsInt32Array() ||
+               typed_array_arg->IsUint32Array() ||
+               typed_array_arg->IsBigInt64Array() ||
+               typed_array_arg->IsBigUint64Array()) {
       int64_t sum = 0;
       for (unsigned i = 0; i < length; ++i) {
         if (typed_array_arg->IsInt32Array()) {
@@ -270,6 +286,45 @@ class FastCApiObject {
     }
   }
 
+  static uint32_t CharCode(char c) { return static_cast<uint8_t>(c); }
+  static uint32_t CharCode(uint16_t c) { return c; }
+
+  template <typename StringType>
+  static uint32_t SumCharCodesFastCallback(Local<Object> receiver,
+                                           const StringType& string_arg,
+                                           FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < string_arg.length; ++i) {
+      sum += CharCode(string_arg.data[i]);
+    }
+    return sum;
+  }
+  static void SumCharCodesSlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 1 || !args[0]->IsString()) {
+      isolate->ThrowError("This method expects a string as first argument.");
+      return;
+    }
+    String::Value string_arg(isolate, args[0]);
+    uint32_t sum = 0;
+    for (int i = 0; i < string_arg.length(); ++i) {
+      sum += (*string_arg)[i];
+    }
+    args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, sum));
+  }
+
   static int32_t AddAllIntInvalidCallback(Local<Object> receiver,
                                           bool should_fallback, int32_t arg_i32,
                                           FastApiCallbackOptions& options) {
@@ -576,6 +631,42 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             SideEffectType::kHasSideEffect,
             &add_all_uint32_typed_array_c_func));
 
+    CFunction add_all_uint8_typed_array_c_func =
+        CFunction::Make(FastCApiObject::AddAllTypedArrayFastCallback<uint8_t>);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_uint8_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_uint8_typed_array_c_func));
+
+    CFunction add_all_int16_typed_array_c_func =
+        CFunction::Make(FastCApiObject::AddAllTypedArrayFastCallback<int16_t>);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_int16_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_int16_typed_array_c_func));
+
+    CFunction sum_char_codes_one_byte_c_func = CFunction::Make(
+        FastCApiObject::SumCharCodesFastCallback<FastOneByteString>);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_char_codes_one_byte",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumCharCodesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_char_codes_one_byte_c_func));
+
+    CFunction sum_char_codes_two_byte_c_func = CFunction::Make(
+        FastCApiObject::SumCharCodesFastCallback<FastTwoByteString>);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_char_codes_two_byte",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumCharCodesSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_char_codes_two_byte_c_func));
+
     const CFunction add_all_overloads[] = {
         add_all_uint32_typed_array_c_func,
         add_all_seq_c_func,
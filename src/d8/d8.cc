@@ -11,6 +11,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iterator>
+#include <set>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -929,6 +930,10 @@ class ModuleEmbedderData {
 
   // Map from (normalized module specifier, module type) pair to Module.
   std::map<std::pair<std::string, ModuleType>, Global<Module>> module_map;
+  // Modules compiled ahead of time by StreamModuleSources that
+  // FetchModuleTree has not picked up yet, keyed like module_map.
+  std::map<std::pair<std::string, ModuleType>, Global<Module>>
+      streamed_module_map;
   // Map from Module to its URL as defined in the ScriptOrigin
   std::unordered_map<Global<Module>, std::string, ModuleGlobalHash>
       module_to_specifier_map;
@@ -974,6 +979,37 @@ MaybeLocal<Module> ResolveModuleCallback(Local<Context> context,
   return module_it->second.Get(isolate);
 }
 
+ScriptOrigin CreateModuleOrigin(Isolate* isolate,
+                                const std::string& file_name) {
+  return ScriptOrigin(
+      isolate, String::NewFromUtf8(isolate, file_name.c_str()).ToLocalChecked(),
+      0, 0, false, -1, Local<Value>(), false, false, true);
+}
+
+// Returns the (absolute path, module type) pairs requested by |module|, which
+// was loaded from |file_name|.
+std::vector<std::pair<std::string, ModuleType>> GetModuleRequests(
+    Local<Context> context, Local<Module> module,
+    const std::string& file_name) {
+  Isolate* isolate = context->GetIsolate();
+  std::string dir_name = DirName(file_name);
+  std::vector<std::pair<std::string, ModuleType>> requests;
+  Local<FixedArray> module_requests = module->GetModuleRequests();
+  for (int i = 0, length = module_requests->Length(); i < length; ++i) {
+    Local<ModuleRequest> module_request =
+        module_requests->Get(context, i).As<ModuleRequest>();
+    Local<String> name = module_request->GetSpecifier();
+    std::string absolute_path =
+        NormalizePath(ToSTLString(isolate, name), dir_name);
+    Local<FixedArray> import_assertions = module_request->GetImportAssertions();
+    ModuleType request_module_type =
+        ModuleEmbedderData::ModuleTypeFromImportAssertions(
+            context, import_assertions, true);
+    requests.emplace_back(absolute_path, request_module_type);
+  }
+  return requests;
+}
+
 }  // anonymous namespace
 
 MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
@@ -982,6 +1018,52 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
                                           ModuleType module_type) {
   DCHECK(IsAbsolutePath(file_name));
   Isolate* isolate = context->GetIsolate();
+  ModuleEmbedderData* d = GetModuleDataFromContext(context);
+  Local<Module> module;
+  auto streamed_it =
+      d->streamed_module_map.find(std::make_pair(file_name, module_type));
+  if (streamed_it != d->streamed_module_map.end()) {
+    module = streamed_it->second.Get(isolate);
+    d->streamed_module_map.erase(streamed_it);
+  } else if (!CompileModuleSource(referrer, context, file_name, module_type)
+                  .ToLocal(&module)) {
+    return MaybeLocal<Module>();
+  }
+
+  CHECK(d->module_map
+            .insert(std::make_pair(std::make_pair(file_name, module_type),
+                                   Global<Module>(isolate, module)))
+            .second);
+  CHECK(d->module_to_specifier_map
+            .insert(std::make_pair(Global<Module>(isolate, module), file_name))
+            .second);
+
+  std::vector<std::pair<std::string, ModuleType>> requests =
+      GetModuleRequests(context, module, file_name);
+  if (options.streaming_compile) StreamModuleSources(context, requests);
+
+  for (const auto& request : requests) {
+    if (request.second == ModuleType::kInvalid) {
+      isolate->ThrowError("Invalid module type was asserted");
+      return MaybeLocal<Module>();
+    }
+
+    if (d->module_map.count(request)) continue;
+
+    if (FetchModuleTree(module, context, request.first, request.second)
+            .IsEmpty()) {
+      return MaybeLocal<Module>();
+    }
+  }
+
+  return module;
+}
+
+MaybeLocal<Module> Shell::CompileModuleSource(Local<Module> referrer,
+                                              Local<Context> context,
+                                              const std::string& file_name,
+                                              ModuleType module_type) {
+  Isolate* isolate = context->GetIsolate();
   Local<String> source_text = ReadFile(isolate, file_name.c_str(), false);
   if (source_text.IsEmpty() && options.fuzzy_module_file_extensions) {
     std::string fallback_file_name = file_name + ".js";
@@ -1005,9 +1087,7 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
         v8::String::NewFromUtf8(isolate, msg.c_str()).ToLocalChecked());
     return MaybeLocal<Module>();
   }
-  ScriptOrigin origin(
-      isolate, String::NewFromUtf8(isolate, file_name.c_str()).ToLocalChecked(),
-      0, 0, false, -1, Local<Value>(), false, false, true);
+  ScriptOrigin origin = CreateModuleOrigin(isolate, file_name);
 
   Local<Module> module;
   if (module_type == ModuleType::kJavaScript) {
@@ -1038,45 +1118,70 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Module> referrer,
     UNREACHABLE();
   }
 
-  CHECK(d->module_map
-            .insert(std::make_pair(std::make_pair(file_name, module_type),
-                                   Global<Module>(isolate, module)))
-            .second);
-  CHECK(d->module_to_specifier_map
-            .insert(std::make_pair(Global<Module>(isolate, module), file_name))
-            .second);
-
-  std::string dir_name = DirName(file_name);
-
-  Local<FixedArray> module_requests = module->GetModuleRequests();
-  for (int i = 0, length = module_requests->Length(); i < length; ++i) {
-    Local<ModuleRequest> module_request =
-        module_requests->Get(context, i).As<ModuleRequest>();
-    Local<String> name = module_request->GetSpecifier();
-    std::string absolute_path =
-        NormalizePath(ToSTLString(isolate, name), dir_name);
-    Local<FixedArray> import_assertions = module_request->GetImportAssertions();
-    ModuleType request_module_type =
-        ModuleEmbedderData::ModuleTypeFromImportAssertions(
-            context, import_assertions, true);
+  return module;
+}
 
-    if (request_module_type == ModuleType::kInvalid) {
-      isolate->ThrowError("Invalid module type was asserted");
-      return MaybeLocal<Module>();
-    }
+void Shell::StreamModuleSources(
+    Local<Context> context,
+    const std::vector<std::pair<std::string, ModuleType>>& requests) {
+  Isolate* isolate = context->GetIsolate();
+  ModuleEmbedderData* d = GetModuleDataFromContext(context);
 
-    if (d->module_map.count(
-            std::make_pair(absolute_path, request_module_type))) {
-      continue;
+  struct PendingModule {
+    std::pair<std::string, ModuleType> key;
+    Local<String> source_text;
+    std::unique_ptr<ScriptCompiler::StreamedSource> streamed_source;
+  };
+  std::set<std::pair<std::string, ModuleType>> started;
+  std::vector<std::pair<std::string, ModuleType>> frontier = requests;
+  // Each round compiles the not yet loaded modules requested so far together,
+  // and the requests of those modules form the next round.
+  while (!frontier.empty()) {
+    std::vector<PendingModule> pending;
+    for (const auto& request : frontier) {
+      if (request.second != ModuleType::kJavaScript) continue;
+      if (d->module_map.count(request) ||
+          d->streamed_module_map.count(request) ||
+          !started.insert(request).second) {
+        continue;
+      }
+      // Modules that can't be read here are left to FetchModuleTree, which
+      // retries with the fuzzy file extensions and reports the error.
+      Local<String> source_text =
+          ReadFile(isolate, request.first.c_str(), false);
+      if (source_text.IsEmpty()) continue;
+      auto streamed_source = std::make_unique<ScriptCompiler::StreamedSource>(
+          std::make_unique<DummySourceStream>(source_text),
+          ScriptCompiler::StreamedSource::UTF8);
+      PostBlockingBackgroundTask(std::make_unique<StreamingCompileTask>(
+          isolate, streamed_source.get(), v8::ScriptType::kModule));
+      pending.push_back({request, source_text, std::move(streamed_source)});
     }
-
-    if (FetchModuleTree(module, context, absolute_path, request_module_type)
-            .IsEmpty()) {
-      return MaybeLocal<Module>();
+    frontier.clear();
+    if (pending.empty()) return;
+
+    // Pump the loop until all the streaming tasks complete.
+    CompleteMessageLoop(isolate);
+    for (PendingModule& module_data : pending) {
+      // Compile errors are dropped here and reported when FetchModuleTree
+      // compiles the module again.
+      TryCatch try_catch(isolate);
+      Local<Module> module;
+      if (!CompileStreamed<Module>(
+               context, module_data.streamed_source.get(),
+               module_data.source_text,
+               CreateModuleOrigin(isolate, module_data.key.first))
+               .ToLocal(&module)) {
+        continue;
+      }
+      d->streamed_module_map.emplace(module_data.key,
+                                     Global<Module>(isolate, module));
+      std::vector<std::pair<std::string, ModuleType>> module_requests =
+          GetModuleRequests(context, module, module_data.key.first);
+      frontier.insert(frontier.end(), module_requests.begin(),
+                      module_requests.end());
     }
   }
-
-  return module;
 }
 
 MaybeLocal<Value> Shell::JSONModuleEvaluationSteps(Local<Context> context,
@@ -716,6 +716,16 @@ class Shell : public i::AllStatic {
                                             v8::Local<v8::Context> context,
                                             const std::string& file_name,
                                             ModuleType module_type);
+  static MaybeLocal<Module> CompileModuleSource(
+      v8::Local<v8::Module> referrer, v8::Local<v8::Context> context,
+      const std::string& file_name, ModuleType module_type);
+  // Compiles the JavaScript modules in |requests|, and the modules they
+  // request in turn, on background threads one level of the module graph at a
+  // time, so that FetchModuleTree can pick them up without compiling them on
+  // the main thread.
+  static void StreamModuleSources(
+      Local<Context> context,
+      const std::vector<std::pair<std::string, ModuleType>>& requests);
 
   static MaybeLocal<Value> JSONModuleEvaluationSteps(Local<Context> context,
                                                      Local<Module> module);
@@ -752,40 +752,48 @@ class CollectFunctionLiterals final
   std::vector<FunctionLiteral*>* literals_;
 };
 
+void ReportCompileError(Isolate* isolate, const v8::TryCatch& try_catch,
+                        debug::LiveEditResult* result) {
+  isolate->OptionalRescheduleException(false);
+  DCHECK(try_catch.HasCaught());
+  result->message = try_catch.Message()->Get();
+  auto self = Utils::OpenHandle(*try_catch.Message());
+  auto msg = i::Handle<i::JSMessageObject>::cast(self);
+  result->line_number = msg->GetLineNumber();
+  result->column_number = msg->GetColumnNumber();
+  result->status = debug::LiveEditResult::COMPILE_ERROR;
+}
+
 bool ParseScript(Isolate* isolate, Handle<Script> script, ParseInfo* parse_info,
-                 bool compile_as_well, std::vector<FunctionLiteral*>* literals,
+                 std::vector<FunctionLiteral*>* literals,
                  debug::LiveEditResult* result) {
   v8::TryCatch try_catch(reinterpret_cast<v8::Isolate*>(isolate));
-  Handle<SharedFunctionInfo> shared;
-  bool success = false;
-  if (compile_as_well) {
-    success = Compiler::CompileForLiveEdit(parse_info, script, isolate)
-                  .ToHandle(&shared);
-  } else {
-    success = parsing::ParseProgram(parse_info, script, isolate,
-                                    parsing::ReportStatisticsMode::kYes);
-    if (!success) {
-      // Throw the parser error.
-      parse_info->pending_error_handler()->PrepareErrors(
-          isolate, parse_info->ast_value_factory());
-      parse_info->pending_error_handler()->ReportErrors(isolate, script);
-    }
-  }
-  if (!success) {
-    isolate->OptionalRescheduleException(false);
-    DCHECK(try_catch.HasCaught());
-    result->message = try_catch.Message()->Get();
-    auto self = Utils::OpenHandle(*try_catch.Message());
-    auto msg = i::Handle<i::JSMessageObject>::cast(self);
-    result->line_number = msg->GetLineNumber();
-    result->column_number = msg->GetColumnNumber();
-    result->status = debug::LiveEditResult::COMPILE_ERROR;
+  if (!parsing::ParseProgram(parse_info, script, isolate,
+                             parsing::ReportStatisticsMode::kYes)) {
+    // Throw the parser error.
+    parse_info->pending_error_handler()->PrepareErrors(
+        isolate, parse_info->ast_value_factory());
+    parse_info->pending_error_handler()->ReportErrors(isolate, script);
+    ReportCompileError(isolate, try_catch, result);
     return false;
   }
   CollectFunctionLiterals(isolate, parse_info->literal()).Run(literals);
   return true;
 }
 
+// Compiles a script that ParseScript has already parsed.
+bool CompileParsedScript(Isolate* isolate, Handle<Script> script,
+                         ParseInfo* parse_info,
+                         debug::LiveEditResult* result) {
+  DCHECK_NOT_NULL(parse_info->literal());
+  v8::TryCatch try_catch(reinterpret_cast<v8::Isolate*>(isolate));
+  if (Compiler::CompileForLiveEdit(parse_info, script, isolate).is_null()) {
+    ReportCompileError(isolate, try_catch, result);
+    return false;
+  }
+  return true;
+}
+
 struct FunctionData {
   explicit FunctionData(FunctionLiteral* literal)
       : literal(literal), stack_position(NOT_ON_STACK) {}
@@ -990,8 +998,7 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
   flags.set_is_eager(true);
   ParseInfo parse_info(isolate, flags, &compile_state);
   std::vector<FunctionLiteral*> literals;
-  if (!ParseScript(isolate, script, &parse_info, false, &literals, result))
-    return;
+  if (!ParseScript(isolate, script, &parse_info, &literals, result)) return;
 
   Handle<Script> new_script = isolate->factory()->CloneScript(script);
   new_script->set_source(*new_source);
@@ -1001,7 +1008,7 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
   new_flags.set_is_eager(true);
   ParseInfo new_parse_info(isolate, new_flags, &new_compile_state);
   std::vector<FunctionLiteral*> new_literals;
-  if (!ParseScript(isolate, new_script, &new_parse_info, true, &new_literals,
+  if (!ParseScript(isolate, new_script, &new_parse_info, &new_literals,
                    result)) {
     return;
   }
@@ -1013,6 +1020,18 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
   LiteralMap unchanged;
   MapLiterals(literal_changes, new_literals, &unchanged, &changed);
 
+  // Unchanged functions keep their old SharedFunctionInfos, so only the
+  // changed ones need bytecode. The remaining new literals are compiled lazily
+  // on first call, should the old function not exist.
+  for (const auto& mapping : unchanged) {
+    if (mapping.second->AllowsLazyCompilation()) {
+      mapping.second->SetShouldLazyCompile();
+    }
+  }
+  if (!CompileParsedScript(isolate, new_script, &new_parse_info, result)) {
+    return;
+  }
+
   FunctionDataMap function_data_map;
   for (const auto& mapping : changed) {
     function_data_map.AddInterestingLiteral(script->id(), mapping.first);
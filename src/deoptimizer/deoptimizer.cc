@@ -519,9 +519,11 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
   disallow_garbage_collection_ = new DisallowGarbageCollection();
 #endif  // DEBUG
   CHECK(CodeKindCanDeoptimize(compiled_code_.kind()));
-  if (!compiled_code_.deopt_already_counted() &&
-      deopt_kind_ == DeoptimizeKind::kSoft) {
-    isolate->counters()->soft_deopts_executed()->Increment();
+  if (!compiled_code_.deopt_already_counted()) {
+    isolate->counters()->deopts_executed()->Increment();
+    if (deopt_kind_ == DeoptimizeKind::kSoft) {
+      isolate->counters()->soft_deopts_executed()->Increment();
+    }
   }
   compiled_code_.set_deopt_already_counted(true);
   {
@@ -2013,15 +2015,17 @@ void Deoptimizer::MaterializeHeapObjects() {
 
   translated_state_.VerifyMaterializedObjects();
 
-  bool feedback_updated = translated_state_.DoUpdateFeedback();
-  if (verbose_tracing_enabled() && feedback_updated) {
+  const char* feedback_update = translated_state_.DoUpdateFeedback();
+  if (feedback_update != nullptr && tracing_enabled() &&
+      (FLAG_trace_deopt_verbose || FLAG_trace_deopt_feedback)) {
     FILE* file = trace_scope()->file();
     Deoptimizer::DeoptInfo info =
         Deoptimizer::GetDeoptInfo(compiled_code_, from_);
     PrintF(file, "Feedback updated from deoptimization at ");
     OFStream outstr(file);
     info.position.Print(outstr, compiled_code_);
-    PrintF(file, ", %s\n", DeoptimizeReasonToString(info.deopt_reason));
+    PrintF(file, ", %s (%s)\n", DeoptimizeReasonToString(info.deopt_reason),
+           feedback_update);
   }
 
   isolate_->materialized_object_store()->Remove(
@@ -13,6 +13,7 @@
 #include "src/diagnostics/disasm.h"
 #include "src/execution/frames.h"
 #include "src/execution/isolate.h"
+#include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/arguments.h"
 #include "src/objects/heap-number-inl.h"
@@ -2107,15 +2108,43 @@ void TranslatedState::VerifyMaterializedObjects() {
 #endif
 }
 
-bool TranslatedState::DoUpdateFeedback() {
-  if (!feedback_vector_handle_.is_null()) {
-    CHECK(!feedback_slot_.IsInvalid());
+const char* TranslatedState::DoUpdateFeedback() {
+  if (feedback_vector_handle_.is_null()) return nullptr;
+  CHECK(!feedback_slot_.IsInvalid());
+  FeedbackNexus nexus(feedback_vector_handle_, feedback_slot_);
+  FeedbackSlotKind kind = nexus.kind();
+
+  // A check guarding a speculative call deoptimized: don't speculate on this
+  // call site anymore.
+  if (IsCallICKind(kind)) {
     isolate()->CountUsage(v8::Isolate::kDeoptimizerDisableSpeculation);
-    FeedbackNexus nexus(feedback_vector_handle_, feedback_slot_);
+    isolate()->counters()->deopt_feedback_speculation_disabled()->Increment();
     nexus.SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
-    return true;
+    return "speculation disabled";
+  }
+
+  // A map check of a property access site deoptimized. Property access sites
+  // only carry their feedback into map checks with
+  // --deopt-generalize-feedback. If the site is already polymorphic, the
+  // optimized code has been invalidated by new maps before and the site
+  // isn't going to settle, so switch it to megamorphic. The next
+  // optimization then emits a generic access for it instead of another
+  // round of map checks. Monomorphic sites are left to the IC, which will
+  // learn the new map as usual.
+  if (!FLAG_deopt_generalize_feedback) return nullptr;
+  if (nexus.ic_state() != POLYMORPHIC) return nullptr;
+  bool changed;
+  if (IsLoadICKind(kind) || IsStoreICKind(kind)) {
+    changed = nexus.ConfigureMegamorphic(PROPERTY);
+  } else if (IsKeyedLoadICKind(kind) || IsKeyedStoreICKind(kind) ||
+             IsKeyedHasICKind(kind)) {
+    changed = nexus.ConfigureMegamorphic(nexus.GetKeyType());
+  } else {
+    return nullptr;
   }
-  return false;
+  if (!changed) return nullptr;
+  isolate()->counters()->deopt_feedback_generalized()->Increment();
+  return "generalized to megamorphic";
 }
 
 void TranslatedState::ReadUpdateFeedback(TranslationArrayIterator* iterator,
@@ -386,7 +386,11 @@ class TranslatedState {
             FILE* trace_file, int parameter_count, int actual_argument_count);
 
   void VerifyMaterializedObjects();
-  bool DoUpdateFeedback();
+  // Updates the feedback slot attributed to the deopt point, if any, so that
+  // the next optimization doesn't specialize on it the same way again.
+  // Returns a description of the update for tracing, or nullptr if the
+  // feedback was left unchanged.
+  const char* DoUpdateFeedback();
 
  private:
   friend TranslatedValue;
@@ -719,6 +719,9 @@ DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(sparkplug_inline_property_loads, false,
+            "inline the monomorphic in-object field case of named property "
+            "loads into Sparkplug code (experimental)")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
@@ -753,6 +756,12 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_prioritize, true,
+            "compile the hottest functions in the concurrent compilation queue "
+            "first")
+DEFINE_FLOAT(concurrent_recompilation_ageing_rate, 1.0,
+             "invocations credited to a queued concurrent compilation job per "
+             "millisecond of waiting")
 DEFINE_BOOL(concurrent_inlining, true,
             "run optimizing compiler's inlining phase on a separate thread")
 DEFINE_BOOL(
@@ -860,6 +869,9 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_BOOL(turbo_inlining_benefit_per_byte, false,
+            "rank inlining candidates by call frequency per inlined bytecode "
+            "byte instead of by call frequency alone")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -896,8 +908,14 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
+DEFINE_BOOL(turbo_loop_bounds_check_elimination, false,
+            "eliminate bounds checks that are dominated by an equivalent loop "
+            "condition in TurboFan")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_INT(turbo_escape_max_dynamic_elements, 4,
+           "maximum number of elements of a virtual object that escape "
+           "analysis resolves loads with a dynamic index for")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
@@ -925,6 +943,9 @@ DEFINE_BOOL(turbo_inline_js_wasm_calls, true, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, false,
             "fall back to the mid-tier register allocator for huge functions "
             "(experimental)")
+DEFINE_BOOL(turbo_loop_aware_regalloc, false,
+            "split live ranges around loops and coalesce copies before "
+            "linear scan register allocation of JavaScript code (experimental)")
 
 DEFINE_BOOL(turbo_optimize_apply, true, "optimize Function.prototype.apply")
 
@@ -1061,6 +1082,9 @@ FOREACH_WASM_STAGING_FEATURE_FLAG(WASM_STAGING_IMPLICATION)
 #undef WASM_STAGING_IMPLICATION
 
 DEFINE_BOOL(wasm_opt, true, "enable wasm optimization")
+DEFINE_BOOL(wasm_loop_aware_regalloc, false,
+            "split live ranges around loops and coalesce copies before "
+            "linear scan register allocation of wasm code (experimental)")
 DEFINE_BOOL(
     wasm_bounds_checks, true,
     "enable bounds checks (disable for performance testing only)")
@@ -1287,6 +1311,9 @@ DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
     TracingFlags::zone_stats.store(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_SIZE_T(zone_segment_pool_size, 2 * MB,
+              "maximum size of unused zone segments an allocator keeps for "
+              "reuse (0 disables the pool)")
 DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
@@ -1329,6 +1356,9 @@ DEFINE_BOOL(flush_baseline_code, false,
             "flush of baseline code when it has not been executed recently")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
+DEFINE_BOOL(flush_bytecode_once, false,
+            "keep the bytecode of functions that were recompiled after their "
+            "bytecode was flushed")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -1424,7 +1454,9 @@ DEFINE_STRING(arm_arch, ARM_ARCH_DEFAULT,
               "available: armv6, armv7, armv7+sudiv or armv8")
 DEFINE_BOOL(force_long_branches, false,
             "force all emitted branches to be in long mode (MIPS/PPC only)")
-DEFINE_STRING(mcpu, "auto", "enable optimization for specific cpu")
+DEFINE_STRING(mcpu, "auto",
+              "enable optimization for specific cpu (x64: auto, generic, "
+              "core, atom, zen)")
 DEFINE_BOOL(partial_constant_pool, true,
             "enable use of partial constant pools (X64 only)")
 DEFINE_STRING(sim_arm64_optional_features, "none",
@@ -1529,6 +1561,9 @@ DEFINE_BOOL(trace, false, "trace javascript function calls")
 // codegen.cc
 DEFINE_BOOL(lazy, true, "use lazy compilation")
 DEFINE_BOOL(lazy_eval, true, "use lazy compilation during eval")
+DEFINE_BOOL(compile_hints_magic, false,
+            "eagerly compile all functions that follow a "
+            "//# allFunctionsCalledOnLoad magic comment")
 DEFINE_BOOL(lazy_streaming, true,
             "use lazy compilation during streaming compilation")
 DEFINE_BOOL(max_lazy, false, "ignore eager compilation hints")
@@ -1542,6 +1577,12 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_BOOL(deopt_generalize_feedback, false,
+            "let the deoptimizer generalize polymorphic property access "
+            "feedback whose map checks keep failing in optimized code")
+DEFINE_BOOL(trace_deopt_feedback, false,
+            "trace feedback updates made by the deoptimizer")
+DEFINE_IMPLICATION(trace_deopt_feedback, trace_deopt)
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_opt, false, "always try to optimize functions")
@@ -1564,6 +1605,11 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(lazy_compile_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_top_level_calls, false,
+            "also post parallel compile tasks for lazy top-level function "
+            "declarations that are called from top-level code")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_top_level_calls,
+                   parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -1841,6 +1887,11 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_BOOL(reorder_builtins, false,
+            "Order builtins in the embedded blob by how often they were "
+            "called according to --turbo-profiling-log-file, placing the "
+            "most frequently called ones next to the bytecode handlers. "
+            "(mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
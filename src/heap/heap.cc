@@ -2503,6 +2503,10 @@ void Heap::MarkCompactEpilogue() {
 
   isolate_->counters()->objs_since_last_full()->Set(0);
 
+  // Zone segments that compile jobs haven't reused since the last full GC are
+  // returned to the system.
+  isolate_->allocator()->TrimSegmentPool();
+
   incremental_marking()->Epilogue();
 
   DCHECK(incremental_marking()->IsStopped());
@@ -4009,6 +4013,7 @@ void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    isolate()->allocator()->ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
@@ -5148,7 +5153,8 @@ void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
       memory_allocator()->Size() + memory_allocator()->Available();
   *stats->os_error = base::OS::GetLastError();
   // TODO(leszeks): Include the string table in both current and peak usage.
-  *stats->malloced_memory = isolate_->allocator()->GetCurrentMemoryUsage();
+  *stats->malloced_memory = isolate_->allocator()->GetCurrentMemoryUsage() +
+                            isolate_->allocator()->GetPooledMemoryUsage();
   *stats->malloced_peak_memory = isolate_->allocator()->GetMaxMemoryUsage();
   if (take_snapshot) {
     HeapObjectIterator iterator(this);
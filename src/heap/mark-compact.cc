@@ -2347,6 +2347,10 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   HeapObject compiled_data = shared_info.GetBytecodeArray(isolate());
   Address compiled_data_start = compiled_data.address();
   int compiled_data_size = compiled_data.Size();
+  shared_info.set_bytecode_was_flushed(true);
+  isolate()->counters()->bytecode_flushed_functions()->Increment();
+  isolate()->counters()->bytecode_flushed_bytes()->Increment(
+      compiled_data_size);
   MemoryChunk* chunk = MemoryChunk::FromAddress(compiled_data_start);
 
   // Clear any recorded slots for the compiled data as being invalid.
@@ -1181,11 +1181,71 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  // Only the variants with an immediate operand are inlined; the constant pool
+  // variants are only used for far jumps and are rare.
+  GotoIf(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false);
+  Branch(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true, &done);
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse, FalseConstant());
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue, TrueConstant());
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               TNode<Oddball> value) {
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  TNode<Object> accumulator = GetAccumulator();
+  TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  // Both paths end in their own dispatch, like the inlined short Star above.
+  Label if_jump(this), if_fallthrough(this);
+  Branch(TaggedEqual(accumulator, value), &if_jump, &if_fallthrough);
+  BIND(&if_jump);
+  Jump(relative_jump);
+  BIND(&if_fallthrough);
+  {
+    Advance();
+    DispatchToBytecode(LoadBytecode(BytecodeOffset()), BytecodeOffset());
+  }
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
   TNode<IntPtrT> target_offset = Advance();
   TNode<WordT> target_bytecode = LoadBytecode(target_offset);
+  if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecodeWithOptionalStarLookahead(target_bytecode);
 }
 
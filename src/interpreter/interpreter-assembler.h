@@ -368,6 +368,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for a JumpIfTrue or JumpIfFalse with an immediate operand and
+  // inline it in a branch, including the subsequent dispatch. Anything after
+  // this point can assume that the following instruction was not such a jump.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| at the current BytecodeOffset(), which
+  // jumps if the accumulator is |value|, and dispatch to the next bytecode.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Oddball> value);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -178,6 +178,8 @@ namespace internal {
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
+  HT(turbofan_optimize_concurrent_queue_wait,                                  \
+     V8.TurboFanOptimizeConcurrentQueueWait, 10000000, MICROSECOND)            \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_execute, V8.TurboFanOptimizeForOnStackReplacementExecute,    \
@@ -291,6 +293,8 @@ namespace internal {
   SC(total_parse_size, V8.TotalParseSize)                          \
   /* Amount of source code skipped over using preparsing. */       \
   SC(total_preparse_skipped, V8.TotalPreparseSkipped)              \
+  /* Amount of source code skipped using a preparse cache. */      \
+  SC(total_preparse_cache_skipped, V8.TotalPreparseCacheSkipped)   \
   /* Amount of compiled source code. */                            \
   SC(total_compile_size, V8.TotalCompileSize)                      \
   /* Number of contexts created from scratch. */                   \
@@ -323,6 +327,12 @@ namespace internal {
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(runtime_profiler_ticks, V8.RuntimeProfilerTicks)                          \
   SC(soft_deopts_executed, V8.SoftDeoptsExecuted)                              \
+  SC(deopts_executed, V8.DeoptsExecuted)                                       \
+  SC(deopt_feedback_speculation_disabled,                                      \
+     V8.DeoptFeedbackSpeculationDisabled)                                      \
+  SC(deopt_feedback_generalized, V8.DeoptFeedbackGeneralized)                  \
+  SC(concurrent_recompilation_jobs_cancelled,                                  \
+     V8.ConcurrentRecompilationJobsCancelled)                                  \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
   SC(new_space_bytes_used, V8.MemoryNewSpaceBytesUsed)                         \
@@ -341,7 +351,12 @@ namespace internal {
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
-  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
+  SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)               \
+  /* Number and total size of bytecode arrays flushed by the GC. */            \
+  SC(bytecode_flushed_functions, V8.BytecodeFlushedFunctions)                  \
+  SC(bytecode_flushed_bytes, V8.BytecodeFlushedBytes)                          \
+  /* Number of functions recompiled after their bytecode was flushed. */       \
+  SC(bytecode_recompiled_after_flush, V8.BytecodeRecompiledAfterFlush)
 
 #define STATS_COUNTER_TS_LIST(SC)                         \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes) \
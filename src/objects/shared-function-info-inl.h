@@ -308,6 +308,8 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, properties_are_final,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags,
                     private_name_lookup_skips_outer_class,
                     SharedFunctionInfo::PrivateNameLookupSkipsOuterClassBit)
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, bytecode_was_flushed,
+                    SharedFunctionInfo::BytecodeWasFlushedBit)
 
 bool SharedFunctionInfo::optimization_disabled() const {
   return disable_optimization_reason() != BailoutReason::kNoReason;
@@ -621,6 +623,10 @@ bool SharedFunctionInfo::ShouldFlushCode(
     return false;
   }
 
+  // Functions that were needed again after their bytecode was flushed are
+  // likely to be needed again, so avoid paying for recompiling them again.
+  if (FLAG_flush_bytecode_once && bytecode_was_flushed()) return false;
+
   // Get a snapshot of the function data field, and if it is a bytecode array,
   // check if it is old. Note, this is done this way since this function can be
   // called by the concurrent marker.
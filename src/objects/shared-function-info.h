@@ -461,6 +461,10 @@ class SharedFunctionInfo
   // closest outer class scope.
   DECL_BOOLEAN_ACCESSORS(private_name_lookup_skips_outer_class)
 
+  // Indicates that the bytecode of the function has been flushed at least
+  // once, so any bytecode it has now was compiled again after that.
+  DECL_BOOLEAN_ACCESSORS(bytecode_was_flushed)
+
   inline FunctionKind kind() const;
 
   // Defines the index in a native context of closure's map instantiated using
@@ -193,6 +193,7 @@ ParseInfo::ParseInfo(const UnoptimizedCompileFlags flags,
       parameters_end_pos_(kNoSourcePosition),
       max_function_literal_id_(kFunctionLiteralIdInvalid),
       character_stream_(nullptr),
+      script_preparse_cache_(nullptr),
       ast_value_factory_(nullptr),
       function_name_(nullptr),
       runtime_call_stats_(nullptr),
@@ -12,6 +12,7 @@
 #include "src/base/bit-field.h"
 #include "src/base/export-template.h"
 #include "src/base/logging.h"
+#include "src/base/vector.h"
 #include "src/common/globals.h"
 #include "src/handles/handles.h"
 #include "src/objects/function-kind.h"
@@ -35,6 +36,7 @@ class DeclarationScope;
 class FunctionLiteral;
 class RuntimeCallStats;
 class Logger;
+class ScriptPreparseCache;
 class SourceRangeMap;
 class Utf16CharacterStream;
 class Zone;
@@ -281,6 +283,21 @@ class V8_EXPORT_PRIVATE ParseInfo {
     return consumed_preparse_data_.get();
   }
 
+  // The cache is owned by the caller and must outlive the ParseInfo.
+  ScriptPreparseCache* script_preparse_cache() const {
+    return script_preparse_cache_;
+  }
+  void set_script_preparse_cache(ScriptPreparseCache* cache) {
+    script_preparse_cache_ = cache;
+  }
+
+  // Sorted source positions of functions to compile eagerly. The positions are
+  // owned by the caller and must outlive the ParseInfo.
+  base::Vector<const int> compile_hints() const { return compile_hints_; }
+  void set_compile_hints(base::Vector<const int> compile_hints) {
+    compile_hints_ = compile_hints;
+  }
+
   DeclarationScope* script_scope() const { return script_scope_; }
   void set_script_scope(DeclarationScope* script_scope) {
     script_scope_ = script_scope;
@@ -344,6 +361,8 @@ class V8_EXPORT_PRIVATE ParseInfo {
   //----------- Inputs+Outputs of parsing and scope analysis -----------------
   std::unique_ptr<Utf16CharacterStream> character_stream_;
   std::unique_ptr<ConsumedPreparseData> consumed_preparse_data_;
+  ScriptPreparseCache* script_preparse_cache_;
+  base::Vector<const int> compile_hints_;
   std::unique_ptr<AstValueFactory> ast_value_factory_;
   const AstRawString* function_name_;
   RuntimeCallStats* runtime_call_stats_;
@@ -3532,6 +3532,7 @@ ParserBase<Impl>::ParseLeftHandSideContinuation(ExpressionT result) {
         // they are actually direct calls to eval is determined at run time.
         Call::PossiblyEval is_possibly_eval =
             CheckPossibleEvalCall(result, is_optional, scope());
+        impl()->MaybePostParallelTaskForCall(result);
 
         result = factory()->NewCall(result, args, pos, has_spread,
                                     is_possibly_eval, is_optional);
@@ -4516,7 +4517,10 @@ ParserBase<Impl>::ParseArrowFunctionLiteral(
 
   FunctionKind kind = formal_parameters.scope->function_kind();
   FunctionLiteral::EagerCompileHint eager_compile_hint =
-      default_eager_compile_hint_;
+      impl()->ShouldEagerCompileFromCompileHints(
+          formal_parameters.scope->start_position())
+          ? FunctionLiteral::kShouldEagerCompile
+          : default_eager_compile_hint_;
   bool can_preparse = impl()->parse_lazily() &&
                       eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
   // TODO(marja): consider lazy-parsing inner arrow functions too. is_this
@@ -25,6 +25,7 @@
 #include "src/objects/scope-info.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/rewriter.h"
+#include "src/parsing/script-preparse-cache.h"
 #include "src/runtime/runtime.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-stream.h"
@@ -431,9 +432,14 @@ Parser::Parser(ParseInfo* info)
       mode_(PARSE_EAGERLY),  // Lazy mode must be set explicitly.
       source_range_map_(info->source_range_map()),
       total_preparse_skipped_(0),
+      total_preparse_cache_skipped_(0),
       consumed_preparse_data_(info->consumed_preparse_data()),
+      script_preparse_cache_(info->script_preparse_cache()),
+      compile_hints_(info->compile_hints()),
       preparse_data_buffer_(),
-      parameters_end_pos_(info->parameters_end_pos()) {
+      parameters_end_pos_(info->parameters_end_pos()),
+      top_level_call_candidate_indices_(info->zone(), 0),
+      top_level_call_candidates_(info->zone()) {
   // Even though we were passed ParseInfo, we should not store it in
   // Parser - this makes sure that Isolate is not accidentally accessed via
   // ParseInfo during background parsing.
@@ -459,6 +465,16 @@ Parser::Parser(ParseInfo* info)
        ++feature) {
     use_counts_[feature] = 0;
   }
+
+  // Symbols spelled out verbatim in an external one-byte source reference it
+  // instead of being copied into the zone.
+  std::shared_ptr<const void> source_lock;
+  base::Vector<const uint8_t> stable_source =
+      info->character_stream()->LockStableOneByteChars(&source_lock);
+  if (!stable_source.empty()) {
+    ast_value_factory()->set_stable_one_byte_source(stable_source,
+                                                    std::move(source_lock));
+  }
 }
 
 void Parser::InitializeEmptyScopeChain(ParseInfo* info) {
@@ -681,6 +697,7 @@ FunctionLiteral* Parser::DoParseProgram(Isolate* isolate, ParseInfo* info) {
 
   if (has_error()) return nullptr;
 
+  PostParallelTasksForTopLevelCalls();
   RecordFunctionLiteralSourceRange(result);
 
   return result;
@@ -1745,6 +1762,7 @@ Statement* Parser::DeclareFunction(const AstRawString* variable_name,
     declaration->var()->set_is_used();
   }
   if (names) names->Add(variable_name, zone());
+  MaybePostParallelTaskForDeclaration(variable_name, function);
   if (kind == SLOPPY_BLOCK_FUNCTION_VARIABLE) {
     Token::Value init = loop_nesting_depth() > 0 ? Token::ASSIGN : Token::INIT;
     SloppyBlockFunctionStatement* statement =
@@ -1756,6 +1774,53 @@ Statement* Parser::DeclareFunction(const AstRawString* variable_name,
   return factory()->EmptyStatement();
 }
 
+bool Parser::ShouldPostParallelTasksForTopLevelCalls() {
+  return V8_UNLIKELY(FLAG_parallel_compile_tasks_for_top_level_calls) &&
+         parse_lazily() && flags().is_toplevel() && info()->parallel_tasks() &&
+         scope()->GetClosureScope()->is_script_scope() &&
+         scanner()->stream()->can_be_cloned_for_parallel_access();
+}
+
+Parser::TopLevelCallCandidate* Parser::GetTopLevelCallCandidate(
+    const AstRawString* name) {
+  auto it = top_level_call_candidate_indices_.find(name);
+  if (it != top_level_call_candidate_indices_.end()) {
+    return &top_level_call_candidates_[it->second];
+  }
+  top_level_call_candidate_indices_.emplace(name,
+                                            top_level_call_candidates_.size());
+  top_level_call_candidates_.push_back({name, nullptr, false});
+  return &top_level_call_candidates_.back();
+}
+
+void Parser::MaybePostParallelTaskForCall(Expression* callee) {
+  if (!callee->IsVariableProxy()) return;
+  if (!ShouldPostParallelTasksForTopLevelCalls()) return;
+  // The declaration may still follow, as function declarations are hoisted,
+  // so tasks are only posted once the whole script has been parsed.
+  GetTopLevelCallCandidate(callee->AsVariableProxy()->raw_name())->is_called =
+      true;
+}
+
+void Parser::MaybePostParallelTaskForDeclaration(const AstRawString* name,
+                                                 FunctionLiteral* function) {
+  if (!scope()->is_script_scope()) return;
+  if (!ShouldPostParallelTasksForTopLevelCalls()) return;
+  // Only the last declaration of a name is ever called. Eagerly compiled
+  // functions are compiled with the script anyway.
+  bool is_lazy = !function->ShouldEagerCompile() &&
+                 function->scope()->was_lazily_parsed();
+  GetTopLevelCallCandidate(name)->declaration = is_lazy ? function : nullptr;
+}
+
+void Parser::PostParallelTasksForTopLevelCalls() {
+  for (const TopLevelCallCandidate& candidate : top_level_call_candidates_) {
+    if (!candidate.is_called || candidate.declaration == nullptr) continue;
+    info()->parallel_tasks()->Enqueue(info(), candidate.name,
+                                      candidate.declaration);
+  }
+}
+
 Statement* Parser::DeclareClass(const AstRawString* variable_name,
                                 Expression* value,
                                 ZonePtrList<const AstRawString>* names,
@@ -2519,7 +2584,8 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   }
 
   FunctionLiteral::EagerCompileHint eager_compile_hint =
-      function_state_->next_function_is_likely_called() || is_wrapped
+      function_state_->next_function_is_likely_called() || is_wrapped ||
+              ShouldEagerCompileFromCompileHints(pos)
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
@@ -2744,6 +2810,38 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
     return true;
   }
 
+  // Top-level functions recorded by an earlier parse of the same source are
+  // skipped without preparsing them again.
+  bool is_top_level_function = script_preparse_cache_ != nullptr &&
+                               function_scope->outer_scope()->is_script_scope();
+  if (is_top_level_function) {
+    const ScriptPreparseCache::Entry* entry =
+        script_preparse_cache_->Lookup(function_scope->start_position());
+    if (entry != nullptr) {
+      if (stack_overflow()) return true;
+      *num_parameters = entry->num_parameters;
+      *function_length = entry->function_length;
+      if (entry->preparse_data != nullptr) {
+        *produced_preparse_data =
+            ProducedPreparseData::For(entry->preparse_data, main_zone());
+      }
+      function_scope->set_end_position(entry->end_position);
+      scanner()->SeekForward(entry->end_position - 1);
+      Expect(Token::RBRACE);
+      int skipped =
+          function_scope->end_position() - function_scope->start_position();
+      total_preparse_skipped_ += skipped;
+      total_preparse_cache_skipped_ += skipped;
+      SetLanguageMode(function_scope, entry->language_mode);
+      if (entry->uses_super_property) {
+        function_scope->RecordSuperPropertyUsage();
+      }
+      SkipFunctionLiterals(entry->num_inner_functions);
+      function_scope->ResetAfterPreparsing(ast_value_factory_, false);
+      return true;
+    }
+  }
+
   Scanner::BookmarkScope bookmark(scanner());
   bookmark.Set(function_scope->start_position());
 
@@ -2802,6 +2900,21 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
           factory(), unresolved_private_tail);
     }
     function_scope->AnalyzePartially(this, factory(), MaybeParsingArrowhead());
+
+    // Functions that call eval have effects on the script scope which the
+    // cache does not record, so they are always preparsed.
+    if (is_top_level_function && !function_scope->inner_scope_calls_eval()) {
+      ZonePreparseData* preparse_data = nullptr;
+      if (*produced_preparse_data != nullptr) {
+        preparse_data = (*produced_preparse_data)
+                            ->Serialize(script_preparse_cache_->zone());
+      }
+      script_preparse_cache_->Add(
+          {function_scope->start_position(), function_scope->end_position(),
+           *num_parameters, *function_length, logger->num_inner_functions(),
+           function_scope->uses_super_property(),
+           function_scope->language_mode(), preparse_data});
+    }
   }
 
   return true;
@@ -3263,6 +3376,8 @@ void Parser::UpdateStatistics(Isolate* isolate, Handle<Script> script) {
   }
   isolate->counters()->total_preparse_skipped()->Increment(
       total_preparse_skipped_);
+  isolate->counters()->total_preparse_cache_skipped()->Increment(
+      total_preparse_cache_skipped_);
 }
 
 void Parser::UpdateStatistics(Handle<Script> script, int* use_counts,
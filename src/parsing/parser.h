@@ -5,6 +5,7 @@
 #ifndef V8_PARSING_PARSER_H_
 #define V8_PARSING_PARSER_H_
 
+#include <algorithm>
 #include <cstddef>
 
 #include "src/ast/ast-source-ranges.h"
@@ -21,6 +22,7 @@
 #include "src/parsing/preparser.h"
 #include "src/utils/pointer-with-payload.h"
 #include "src/zone/zone-chunk-list.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 
@@ -34,6 +36,7 @@ class ParserTarget;
 class ParserTargetScope;
 class PendingCompilationErrorHandler;
 class PreparseData;
+class ScriptPreparseCache;
 
 // ----------------------------------------------------------------------------
 // JAVASCRIPT PARSING
@@ -313,6 +316,38 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
                              FunctionLiteral* function, VariableMode mode,
                              VariableKind kind, int beg_pos, int end_pos,
                              ZonePtrList<const AstRawString>* names);
+  struct TopLevelCallCandidate {
+    const AstRawString* name;
+    // The last lazily parsed declaration of {name} at script scope, if any.
+    FunctionLiteral* declaration;
+    bool is_called;
+  };
+  // Functions called from top-level code are likely to be needed soon after
+  // the script runs, so with --parallel-compile-tasks-for-top-level-calls the
+  // lazily parsed top-level function declarations they refer to are compiled
+  // on the compiler dispatcher ahead of their first call. As declarations are
+  // hoisted and may be redeclared, the tasks are posted once the script has
+  // been parsed.
+  bool ShouldPostParallelTasksForTopLevelCalls();
+  TopLevelCallCandidate* GetTopLevelCallCandidate(const AstRawString* name);
+  void MaybePostParallelTaskForCall(Expression* callee);
+  void MaybePostParallelTaskForDeclaration(const AstRawString* name,
+                                           FunctionLiteral* function);
+  void PostParallelTasksForTopLevelCalls();
+
+  // Functions are compiled eagerly if the embedder passed their position as
+  // a compile hint or, with --compile-hints-magic, if they follow a
+  // //# allFunctionsCalledOnLoad magic comment. |position| is the function
+  // token position, or the start of the parameters for arrow functions.
+  V8_INLINE bool ShouldEagerCompileFromCompileHints(int position) const {
+    if (V8_UNLIKELY(FLAG_compile_hints_magic) &&
+        scanner()->SawMagicCommentCompileHintsAll()) {
+      return true;
+    }
+    return V8_UNLIKELY(!compile_hints_.empty()) &&
+           std::binary_search(compile_hints_.begin(), compile_hints_.end(),
+                              position);
+  }
   Variable* CreateSyntheticContextVariable(const AstRawString* synthetic_name);
   Variable* CreatePrivateNameVariable(ClassScope* scope, VariableMode mode,
                                       IsStaticFlag is_static_flag,
@@ -1077,9 +1112,12 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   // parsing.
   int use_counts_[v8::Isolate::kUseCounterFeatureCount];
   int total_preparse_skipped_;
+  int total_preparse_cache_skipped_;
   bool allow_lazy_;
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
+  ScriptPreparseCache* script_preparse_cache_;
+  base::Vector<const int> compile_hints_;
   std::vector<uint8_t> preparse_data_buffer_;
 
   // If not kNoSourcePosition, indicates that the first function literal
@@ -1087,6 +1125,12 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   // indicates the correct position of the ')' that closes the parameter list.
   // After that ')' is encountered, this field is reset to kNoSourcePosition.
   int parameters_end_pos_;
+
+  // Names that are declared as functions or called at top level, in the order
+  // they were first seen, and their indices in that list.
+  ZoneUnorderedMap<const AstRawString*, size_t>
+      top_level_call_candidate_indices_;
+  ZoneVector<TopLevelCallCandidate> top_level_call_candidates_;
 };
 
 }  // namespace internal
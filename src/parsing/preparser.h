@@ -1176,6 +1176,13 @@ class PreParser : public ParserBase<PreParser> {
     return Statement::Default();
   }
 
+  V8_INLINE void MaybePostParallelTaskForCall(
+      const PreParserExpression& callee) {}
+
+  V8_INLINE bool ShouldEagerCompileFromCompileHints(int position) const {
+    return false;
+  }
+
   V8_INLINE PreParserStatement DeclareClass(
       const PreParserIdentifier& variable_name,
       const PreParserExpression& value, ZonePtrList<const AstRawString>* names,
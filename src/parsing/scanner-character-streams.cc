@@ -118,6 +118,14 @@ class ExternalStringStream {
     return {&data_[std::min(length_, pos)], &data_[length_]};
   }
 
+  // Returns all characters of the stream, indexed by position. They stay valid
+  // and at a fixed address for as long as |lock| is held, even after the
+  // stream is destroyed.
+  Range<Char> LockChars(std::shared_ptr<const void>* lock) const {
+    *lock = std::make_shared<ScopedExternalStringLock>(lock_);
+    return {data_, &data_[length_]};
+  }
+
   static const bool kCanBeCloned = true;
   static const bool kCanAccessHeap = false;
 
@@ -148,6 +156,41 @@ class TestingStream {
   const size_t length_;
 };
 
+// A Char stream backed by an off-heap copy of the [start, end) range of
+// another stream, so that the range can be accessed from other threads even
+// if the original stream is backed by the V8 heap.
+template <typename Char>
+class CopiedStream {
+ public:
+  template <typename ByteStream>
+  CopiedStream(ByteStream* source, size_t start, size_t end) : start_(start) {
+    DisallowGarbageCollection no_gc;
+    Range<Char> range = source->GetDataAt(start, nullptr, &no_gc);
+    size_t length = std::min(range.length(), end - start);
+    data_ = std::make_shared<std::vector<Char>>(range.start,
+                                                range.start + length);
+  }
+
+  // The no_gc argument is only here because of the templated way this class
+  // is used along with other implementations that require V8 heap access.
+  Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
+                        DisallowGarbageCollection* no_gc = nullptr) {
+    const Char* data = data_->data();
+    size_t length = data_->size();
+    // Positions before the copied range are never read, treat them as the end
+    // of input.
+    if (V8_UNLIKELY(pos < start_)) return {&data[length], &data[length]};
+    return {&data[std::min(length, pos - start_)], &data[length]};
+  }
+
+  static const bool kCanBeCloned = true;
+  static const bool kCanAccessHeap = false;
+
+ private:
+  size_t start_;
+  std::shared_ptr<const std::vector<Char>> data_;
+};
+
 // A Char stream backed by multiple source-stream provided off-heap chunks.
 template <typename Char>
 class ChunkedStream {
@@ -230,6 +273,25 @@ class ChunkedStream {
   std::vector<struct Chunk> chunks_;
 };
 
+namespace {
+
+// Only external strings keep their characters at a fixed address that can
+// outlive the stream.
+template <typename ByteStream>
+base::Vector<const uint8_t> LockStableChars(const ByteStream& stream,
+                                            std::shared_ptr<const void>* lock) {
+  return {};
+}
+
+base::Vector<const uint8_t> LockStableChars(
+    const ExternalStringStream<uint8_t>& stream,
+    std::shared_ptr<const void>* lock) {
+  Range<uint8_t> range = stream.LockChars(lock);
+  return {range.start, range.length()};
+}
+
+}  // namespace
+
 // Provides a buffered utf-16 view on the bytes from the underlying ByteStream.
 // Chars are buffered if either the underlying stream isn't utf-16 or the
 // underlying utf-16 stream might move (is on-heap).
@@ -251,6 +313,22 @@ class BufferedCharacterStream : public Utf16CharacterStream {
         new BufferedCharacterStream<ByteStream>(*this));
   }
 
+  bool can_copy_range() const final {
+    return ByteStream<uint8_t>::kCanAccessHeap;
+  }
+
+  std::unique_ptr<Utf16CharacterStream> CopyRange(size_t start,
+                                                  size_t end) final {
+    return std::unique_ptr<Utf16CharacterStream>(
+        new BufferedCharacterStream<CopiedStream>(start, &byte_stream_, start,
+                                                  end));
+  }
+
+  base::Vector<const uint8_t> LockStableOneByteChars(
+      std::shared_ptr<const void>* lock) final {
+    return LockStableChars(byte_stream_, lock);
+  }
+
  protected:
   bool ReadBlock(size_t position) final {
     buffer_pos_ = position;
@@ -307,6 +385,17 @@ class UnbufferedCharacterStream : public Utf16CharacterStream {
         new UnbufferedCharacterStream<ByteStream>(*this));
   }
 
+  bool can_copy_range() const final {
+    return ByteStream<uint16_t>::kCanAccessHeap;
+  }
+
+  std::unique_ptr<Utf16CharacterStream> CopyRange(size_t start,
+                                                  size_t end) final {
+    return std::unique_ptr<Utf16CharacterStream>(
+        new UnbufferedCharacterStream<CopiedStream>(start, &byte_stream_, start,
+                                                    end));
+  }
+
  protected:
   bool ReadBlock(size_t position) final {
     buffer_pos_ = position;
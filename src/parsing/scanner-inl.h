@@ -193,7 +193,6 @@ enum class ScanFlags : uint8_t {
   kCannotBeKeywordStart = 1 << 2,
   kStringTerminator = 1 << 3,
   kIdentifierNeedsSlowPath = 1 << 4,
-  kMultilineCommentCharacterNeedsSlowPath = 1 << 5,
 };
 constexpr uint8_t GetScanFlags(char c) {
   return
@@ -218,13 +217,7 @@ constexpr uint8_t GetScanFlags(char c) {
            : 0) |
       // Escapes are processed on the slow path.
       (c == '\\' ? static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath)
-                 : 0) |
-      // Newlines and * are interesting characters for multiline comment
-      // scanning.
-      (c == '\n' || c == '\r' || c == '*'
-           ? static_cast<uint8_t>(
-                 ScanFlags::kMultilineCommentCharacterNeedsSlowPath)
-           : 0);
+                 : 0);
 }
 inline bool TerminatesLiteral(uint8_t scan_flags) {
   return (scan_flags & static_cast<uint8_t>(ScanFlags::kTerminatesLiteral));
@@ -236,10 +229,6 @@ inline bool IdentifierNeedsSlowPath(uint8_t scan_flags) {
   return (scan_flags &
           static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath));
 }
-inline bool MultilineCommentCharacterNeedsSlowPath(uint8_t scan_flags) {
-  return (scan_flags & static_cast<uint8_t>(
-                           ScanFlags::kMultilineCommentCharacterNeedsSlowPath));
-}
 inline bool MayTerminateString(uint8_t scan_flags) {
   return (scan_flags & static_cast<uint8_t>(ScanFlags::kStringTerminator));
 }
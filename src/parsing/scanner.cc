@@ -96,6 +96,7 @@ Scanner::Scanner(Utf16CharacterStream* source, UnoptimizedCompileFlags flags)
     : flags_(flags),
       source_(source),
       found_html_comment_(false),
+      saw_magic_comment_compile_hints_all_(false),
       octal_pos_(Location::invalid()),
       octal_message_(MessageTemplate::kNone) {
   DCHECK_NOT_NULL(source);
@@ -211,7 +212,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  static constexpr base::uc16 kLineTerminators[] = {'\n', '\r', 0x2028,
+                                                    0x2029};
+  AdvanceUntilAnyOf(kLineTerminators);
 
   return Token::WHITESPACE;
 }
@@ -225,8 +228,9 @@ Token::Value Scanner::SkipSourceURLComment() {
 }
 
 void Scanner::TryToParseSourceURLComment() {
-  // Magic comments are of the form: //[#@]\s<name>=\s*<value>\s*.* and this
-  // function will just return if it cannot parse a magic comment.
+  // Magic comments are of the form: //[#@]\s<name>=\s*<value>\s*.* or
+  // //[#@]\s<name> for names without a value, and this function will just
+  // return if it cannot parse a magic comment.
   DCHECK(!IsWhiteSpaceOrLineTerminator(kEndOfInput));
   if (!IsWhiteSpace(c0_)) return;
   Advance();
@@ -245,6 +249,11 @@ void Scanner::TryToParseSourceURLComment() {
     value = &source_url_;
   } else if (name_literal == base::StaticOneByteVector("sourceMappingURL")) {
     value = &source_mapping_url_;
+  } else if (name_literal ==
+             base::StaticOneByteVector("allFunctionsCalledOnLoad")) {
+    // This one takes no value.
+    saw_magic_comment_compile_hints_all_ = true;
+    return;
   } else {
     return;
   }
@@ -278,13 +287,11 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      // Newlines and * are interesting characters for multiline comment
+      // scanning.
+      static constexpr base::uc16 kStarOrLineTerminators[] = {
+          '*', '\n', '\r', 0x2028, 0x2029};
+      AdvanceUntilAnyOf(kStarOrLineTerminators);
 
       while (c0_ == '*') {
         Advance();
@@ -303,7 +310,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    static constexpr base::uc16 kStar[] = {'*'};
+    AdvanceUntilAnyOf(kStar);
 
     while (c0_ == '*') {
       Advance();
@@ -1007,10 +1015,34 @@ base::Optional<RegExpFlags> Scanner::ScanRegExpFlags() {
   return flags;
 }
 
+// static
+const AstRawString* Scanner::OneByteSymbol(
+    AstValueFactory* ast_value_factory, const TokenDesc& token,
+    base::Vector<const uint8_t> literal) {
+  base::Vector<const uint8_t> source =
+      ast_value_factory->stable_one_byte_source();
+  if (!source.empty() &&
+      (token.token == Token::STRING || token.token == Token::PRIVATE_NAME ||
+       Token::IsAnyIdentifier(token.token) || Token::IsKeyword(token.token)) &&
+      !LiteralContainsEscapes(token)) {
+    int start = token.location.beg_pos;
+    // Skip the opening delimiter.
+    if (token.token == Token::STRING) start++;
+    int end = start + literal.length();
+    if (end <= source.length()) {
+      DCHECK(literal == source.SubVector(start, end));
+      return ast_value_factory->GetOneByteStringFromStableSource(
+          source.SubVector(start, end));
+    }
+  }
+  return ast_value_factory->GetOneByteString(literal);
+}
+
 const AstRawString* Scanner::CurrentSymbol(
     AstValueFactory* ast_value_factory) const {
   if (is_literal_one_byte()) {
-    return ast_value_factory->GetOneByteString(literal_one_byte_string());
+    return OneByteSymbol(ast_value_factory, current(),
+                         literal_one_byte_string());
   }
   return ast_value_factory->GetTwoByteString(literal_two_byte_string());
 }
@@ -1018,7 +1050,8 @@ const AstRawString* Scanner::CurrentSymbol(
 const AstRawString* Scanner::NextSymbol(
     AstValueFactory* ast_value_factory) const {
   if (is_next_literal_one_byte()) {
-    return ast_value_factory->GetOneByteString(next_literal_one_byte_string());
+    return OneByteSymbol(ast_value_factory, next(),
+                         next_literal_one_byte_string());
   }
   return ast_value_factory->GetTwoByteString(next_literal_two_byte_string());
 }
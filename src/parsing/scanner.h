@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/logging.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
@@ -23,6 +24,15 @@
 #include "src/utils/allocation.h"
 #include "src/utils/pointer-with-payload.h"
 
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && \
+     (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))
+#define V8_SCANNER_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define V8_SCANNER_USE_SSE2 0
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -94,6 +104,29 @@ class Utf16CharacterStream {
     }
   }
 
+  // Returns and advances past the next UTF-16 code unit in the input stream
+  // that is one of |chars|. If there are no more code units it returns
+  // kEndOfInput. Equivalent to AdvanceUntil with a check for |chars|, but
+  // searches the buffer a block of code units at a time.
+  template <size_t N>
+  V8_INLINE base::uc32 AdvanceUntilAnyOf(const base::uc16 (&chars)[N]) {
+    while (true) {
+      const base::uc16* next_cursor_pos =
+          FindFirstOf(buffer_cursor_, buffer_end_, chars);
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked(pos())) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<base::uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -120,9 +153,21 @@ class Utf16CharacterStream {
     }
   }
 
-  // Returns true if the stream could access the V8 heap after construction.
+  // Returns true if the stream, or a range of it, can be cloned with
+  // CloneForParallelAccess.
   bool can_be_cloned_for_parallel_access() const {
-    return can_be_cloned() && !can_access_heap();
+    return (can_be_cloned() && !can_access_heap()) || can_copy_range();
+  }
+
+  // Returns a stream that can be accessed from another thread and covers at
+  // least the [start, end) range of this stream. Streams backed by the V8 heap
+  // copy the range off-heap, so this must be called on the main thread for
+  // them.
+  std::unique_ptr<Utf16CharacterStream> CloneForParallelAccess(size_t start,
+                                                               size_t end) {
+    DCHECK(can_be_cloned_for_parallel_access());
+    if (can_be_cloned() && !can_access_heap()) return Clone();
+    return CopyRange(start, end);
   }
 
   // Returns true if the stream can be cloned with Clone.
@@ -136,6 +181,25 @@ class Utf16CharacterStream {
   // Returns true if the stream could access the V8 heap after construction.
   virtual bool can_access_heap() const = 0;
 
+  // Returns true if a range of the stream can be copied with CopyRange.
+  virtual bool can_copy_range() const { return false; }
+
+  // Returns a stream over an off-heap copy of the [start, end) range of this
+  // stream, using the same positions.
+  virtual std::unique_ptr<Utf16CharacterStream> CopyRange(size_t start,
+                                                          size_t end) {
+    UNREACHABLE();
+  }
+
+  // If the stream's characters are one-byte and stored off-heap at a fixed
+  // address, returns all of them indexed by stream position and sets |lock| to
+  // a handle that keeps them valid after the stream is destroyed. Otherwise
+  // returns an empty vector.
+  virtual base::Vector<const uint8_t> LockStableOneByteChars(
+      std::shared_ptr<const void>* lock) {
+    return {};
+  }
+
   RuntimeCallStats* runtime_call_stats() const { return runtime_call_stats_; }
   void set_runtime_call_stats(RuntimeCallStats* runtime_call_stats) {
     runtime_call_stats_ = runtime_call_stats;
@@ -151,6 +215,37 @@ class Utf16CharacterStream {
         buffer_pos_(buffer_pos) {}
   Utf16CharacterStream() : Utf16CharacterStream(nullptr, nullptr, nullptr, 0) {}
 
+  // Returns the first code unit in [start, end) that is one of |chars|, or
+  // |end| if there is none.
+  template <size_t N>
+  static V8_INLINE const base::uc16* FindFirstOf(
+      const base::uc16* start, const base::uc16* end,
+      const base::uc16 (&chars)[N]) {
+#if V8_SCANNER_USE_SSE2
+    static constexpr int kBlockSize = sizeof(__m128i) / sizeof(base::uc16);
+    while (end - start >= kBlockSize) {
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+      __m128i matches = _mm_setzero_si128();
+      for (size_t i = 0; i < N; i++) {
+        __m128i needle = _mm_set1_epi16(static_cast<int16_t>(chars[i]));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi16(block, needle));
+      }
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+      if (mask != 0) {
+        return start + base::bits::CountTrailingZerosNonZero(mask) /
+                           sizeof(base::uc16);
+      }
+      start += kBlockSize;
+    }
+#endif  // V8_SCANNER_USE_SSE2
+    return std::find_if(start, end, [&chars](base::uc16 c) {
+      for (size_t i = 0; i < N; i++) {
+        if (c == chars[i]) return true;
+      }
+      return false;
+    });
+  }
+
   bool ReadBlockChecked(size_t position) {
     // The callers of this method (Back/Back2/Seek) should handle the easy
     // case (seeking within the current buffer), and we should only get here
@@ -418,6 +513,11 @@ class V8_EXPORT_PRIVATE Scanner {
 
   bool FoundHtmlComment() const { return found_html_comment_; }
 
+  // Whether a //# allFunctionsCalledOnLoad magic comment has been scanned.
+  bool SawMagicCommentCompileHintsAll() const {
+    return saw_magic_comment_compile_hints_all_;
+  }
+
   const Utf16CharacterStream* stream() const { return source_; }
 
  private:
@@ -535,6 +635,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <size_t N>
+  V8_INLINE void AdvanceUntilAnyOf(const base::uc16 (&chars)[N]) {
+    c0_ = source_->AdvanceUntilAnyOf(chars);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -705,6 +810,12 @@ class V8_EXPORT_PRIVATE Scanner {
     return token.literal_chars.length() != source_length;
   }
 
+  // Returns the symbol for the one-byte literal of |token|. Literals spelled
+  // out verbatim in a stable source reference it rather than being copied.
+  static const AstRawString* OneByteSymbol(AstValueFactory* ast_value_factory,
+                                           const TokenDesc& token,
+                                           base::Vector<const uint8_t> literal);
+
 #ifdef DEBUG
   void SanityCheckTokenDesc(const TokenDesc&) const;
 #endif
@@ -735,6 +846,7 @@ class V8_EXPORT_PRIVATE Scanner {
   // Values parsed from magic comments.
   LiteralBuffer source_url_;
   LiteralBuffer source_mapping_url_;
+  bool saw_magic_comment_compile_hints_all_;
 
   // Last-seen positions of potentially problematic tokens.
   Location octal_pos_;
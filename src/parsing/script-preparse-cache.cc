@@ -0,0 +1,282 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/script-preparse-cache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "src/flags/flags.h"
+#include "src/objects/string-inl.h"
+#include "src/parsing/preparse-data-impl.h"
+#include "src/snapshot/snapshot-utils.h"
+#include "src/utils/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The blob starts with a fixed header of uint32 fields, followed by the
+// payload covered by the checksum:
+//
+//   for each entry:
+//     start_position, end_position, num_parameters, function_length,
+//     num_inner_functions, flags (kUsesSuperProperty | kIsStrict),
+//     preparse data tree
+//
+//   preparse data tree:
+//     0, if there is no data, or
+//     1, byte length, bytes (padded to 4), child count, child trees
+#ifdef DEBUG
+constexpr uint32_t kMagicNumber = 0x50524531;  // "PRE1"
+#else
+constexpr uint32_t kMagicNumber = 0x70726531;  // "pre1"
+#endif
+
+constexpr int kMagicNumberOffset = 0;
+constexpr int kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
+constexpr int kFlagHashOffset = kVersionHashOffset + kUInt32Size;
+constexpr int kSourceLengthOffset = kFlagHashOffset + kUInt32Size;
+constexpr int kSourceHashOffset = kSourceLengthOffset + kUInt32Size;
+constexpr int kEntryCountOffset = kSourceHashOffset + kUInt32Size;
+constexpr int kChecksumOffset = kEntryCountOffset + kUInt32Size;
+constexpr int kHeaderSize = kChecksumOffset + kUInt32Size;
+
+constexpr uint32_t kUsesSuperProperty = 1 << 0;
+constexpr uint32_t kIsStrict = 1 << 1;
+
+// Bounds the recursion when reading back preparse data trees.
+constexpr int kMaxNestingDepth = 1024;
+
+class Writer {
+ public:
+  explicit Writer(std::vector<uint8_t>* out) : out_(out) {}
+
+  void Put(uint32_t value) {
+    uint8_t bytes[kUInt32Size];
+    memcpy(bytes, &value, kUInt32Size);
+    out_->insert(out_->end(), bytes, bytes + kUInt32Size);
+  }
+
+  void PutBytes(const uint8_t* data, size_t length) {
+    out_->insert(out_->end(), data, data + length);
+    out_->resize(RoundUp<kUInt32Size>(out_->size()));
+  }
+
+  void PutPreparseData(ZonePreparseData* data) {
+    if (data == nullptr) {
+      Put(0);
+      return;
+    }
+    Put(1);
+    ZoneVector<uint8_t>* bytes = data->byte_data();
+    Put(static_cast<uint32_t>(bytes->size()));
+    PutBytes(bytes->data(), bytes->size());
+    Put(data->children_length());
+    for (int i = 0; i < data->children_length(); i++) {
+      PutPreparseData(data->get_child(i));
+    }
+  }
+
+ private:
+  std::vector<uint8_t>* out_;
+};
+
+class Reader {
+ public:
+  explicit Reader(base::Vector<const uint8_t> data) : data_(data) {}
+
+  bool Get(uint32_t* value) {
+    if (data_.size() - position_ < sizeof(*value)) return false;
+    memcpy(value, data_.begin() + position_, sizeof(*value));
+    position_ += sizeof(*value);
+    return true;
+  }
+
+  bool GetInt(int* value) {
+    uint32_t raw;
+    if (!Get(&raw) || raw > static_cast<uint32_t>(kMaxInt)) return false;
+    *value = static_cast<int>(raw);
+    return true;
+  }
+
+  bool GetPreparseData(Zone* zone, int depth, ZonePreparseData** result) {
+    uint32_t has_data;
+    if (!Get(&has_data) || has_data > 1) return false;
+    if (has_data == 0) {
+      *result = nullptr;
+      return true;
+    }
+    if (depth > kMaxNestingDepth) return false;
+    int byte_length;
+    if (!GetInt(&byte_length)) return false;
+    size_t padded_length = RoundUp<kUInt32Size>(byte_length);
+    if (data_.size() - position_ < padded_length) return false;
+    base::Vector<uint8_t> bytes(
+        const_cast<uint8_t*>(data_.begin() + position_), byte_length);
+    position_ += padded_length;
+    int children_length;
+    if (!GetInt(&children_length)) return false;
+    // Every child needs at least one word.
+    if (static_cast<size_t>(children_length) >
+        (data_.size() - position_) / sizeof(uint32_t)) {
+      return false;
+    }
+    ZonePreparseData* data =
+        zone->New<ZonePreparseData>(zone, &bytes, children_length);
+    for (int i = 0; i < children_length; i++) {
+      ZonePreparseData* child;
+      if (!GetPreparseData(zone, depth + 1, &child)) return false;
+      // Only functions with data are recorded as children.
+      if (child == nullptr) return false;
+      data->set_child(i, child);
+    }
+    *result = data;
+    return true;
+  }
+
+  bool AtEnd() const { return position_ == data_.size(); }
+
+ private:
+  base::Vector<const uint8_t> data_;
+  size_t position_ = 0;
+};
+
+uint32_t ReadHeaderField(base::Vector<const uint8_t> data, int offset) {
+  uint32_t value;
+  memcpy(&value, data.begin() + offset, kUInt32Size);
+  return value;
+}
+
+void WriteHeaderField(std::vector<uint8_t>* data, int offset,
+                      uint32_t value) {
+  memcpy(data->data() + offset, &value, kUInt32Size);
+}
+
+// The recorded positions are only valid for the exact source they were
+// produced for, so the cache is keyed on a checksum of its characters. Unlike
+// String::Hash, this doesn't depend on the per-isolate hash seed.
+uint32_t SourceHash(Isolate* isolate, Handle<String> source) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  if (content.IsOneByte()) return Checksum(content.ToOneByteVector());
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  return Checksum(base::Vector<const byte>(
+      reinterpret_cast<const byte*>(chars.begin()),
+      chars.length() * sizeof(base::uc16)));
+}
+
+}  // namespace
+
+void ScriptPreparseCache::Add(const Entry& entry) {
+  DCHECK_LT(entry.start_position, entry.end_position);
+  auto it = std::lower_bound(entries_.begin(), entries_.end(),
+                             entry.start_position,
+                             [](const Entry& e, int position) {
+                               return e.start_position < position;
+                             });
+  if (it != entries_.end() && it->start_position == entry.start_position) {
+    *it = entry;
+  } else {
+    entries_.insert(it, entry);
+  }
+}
+
+const ScriptPreparseCache::Entry* ScriptPreparseCache::Lookup(
+    int start_position) const {
+  auto it = std::lower_bound(entries_.begin(), entries_.end(), start_position,
+                             [](const Entry& e, int position) {
+                               return e.start_position < position;
+                             });
+  if (it == entries_.end() || it->start_position != start_position) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+std::vector<uint8_t> ScriptPreparseCache::Serialize(
+    Isolate* isolate, Handle<String> source) const {
+  std::vector<uint8_t> result(kHeaderSize);
+  Writer writer(&result);
+  for (const Entry& entry : entries_) {
+    writer.Put(entry.start_position);
+    writer.Put(entry.end_position);
+    writer.Put(entry.num_parameters);
+    writer.Put(entry.function_length);
+    writer.Put(entry.num_inner_functions);
+    uint32_t flags = 0;
+    if (entry.uses_super_property) flags |= kUsesSuperProperty;
+    if (is_strict(entry.language_mode)) flags |= kIsStrict;
+    writer.Put(flags);
+    writer.PutPreparseData(entry.preparse_data);
+  }
+
+  WriteHeaderField(&result, kMagicNumberOffset, kMagicNumber);
+  WriteHeaderField(&result, kVersionHashOffset, Version::Hash());
+  WriteHeaderField(&result, kFlagHashOffset, FlagList::Hash());
+  WriteHeaderField(&result, kSourceLengthOffset, source->length());
+  WriteHeaderField(&result, kSourceHashOffset, SourceHash(isolate, source));
+  WriteHeaderField(&result, kEntryCountOffset, size());
+  base::Vector<const uint8_t> payload(result.data() + kHeaderSize,
+                                      result.size() - kHeaderSize);
+  WriteHeaderField(&result, kChecksumOffset, Checksum(payload));
+  return result;
+}
+
+// static
+ScriptPreparseCache* ScriptPreparseCache::Deserialize(
+    Zone* zone, base::Vector<const uint8_t> data, Isolate* isolate,
+    Handle<String> source) {
+  int source_length = source->length();
+  if (data.length() < kHeaderSize) return nullptr;
+  if (ReadHeaderField(data, kMagicNumberOffset) != kMagicNumber ||
+      ReadHeaderField(data, kVersionHashOffset) != Version::Hash() ||
+      ReadHeaderField(data, kFlagHashOffset) != FlagList::Hash() ||
+      ReadHeaderField(data, kSourceLengthOffset) !=
+          static_cast<uint32_t>(source_length)) {
+    return nullptr;
+  }
+  base::Vector<const uint8_t> payload =
+      data.SubVector(kHeaderSize, data.size());
+  if (ReadHeaderField(data, kChecksumOffset) != Checksum(payload) ||
+      ReadHeaderField(data, kSourceHashOffset) != SourceHash(isolate, source)) {
+    return nullptr;
+  }
+
+  ScriptPreparseCache* cache = zone->New<ScriptPreparseCache>(zone);
+  Reader reader(payload);
+  uint32_t entry_count = ReadHeaderField(data, kEntryCountOffset);
+  int previous_end_position = 0;
+  for (uint32_t i = 0; i < entry_count; i++) {
+    Entry entry;
+    uint32_t flags;
+    if (!reader.GetInt(&entry.start_position) ||
+        !reader.GetInt(&entry.end_position) ||
+        !reader.GetInt(&entry.num_parameters) ||
+        !reader.GetInt(&entry.function_length) ||
+        !reader.GetInt(&entry.num_inner_functions) || !reader.Get(&flags) ||
+        !reader.GetPreparseData(zone, 0, &entry.preparse_data)) {
+      return nullptr;
+    }
+    // Top-level functions don't overlap, so entries are strictly ordered.
+    if (entry.start_position < previous_end_position ||
+        entry.end_position <= entry.start_position ||
+        entry.end_position > source_length ||
+        (flags & ~(kUsesSuperProperty | kIsStrict)) != 0) {
+      return nullptr;
+    }
+    previous_end_position = entry.end_position;
+    entry.uses_super_property = (flags & kUsesSuperProperty) != 0;
+    entry.language_mode =
+        (flags & kIsStrict) ? LanguageMode::kStrict : LanguageMode::kSloppy;
+    cache->entries_.push_back(entry);
+  }
+  if (!reader.AtEnd()) return nullptr;
+  return cache;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,79 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCRIPT_PREPARSE_CACHE_H_
+#define V8_PARSING_SCRIPT_PREPARSE_CACHE_H_
+
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class String;
+class ZonePreparseData;
+
+// Records, for each lazily compiled top-level function of a script, what the
+// preparser learned about it: where it ends, its parameter counts, its
+// language mode and the PreparseData for its inner functions. The cache can be
+// serialized to a standalone, versioned blob and handed to a later top-level
+// parse of the same source, which then skips those functions without
+// preparsing them again.
+//
+// Unlike the code cache, the blob holds no heap objects, so it stays usable for
+// scripts that are not (or cannot be) fully code-cached.
+class V8_EXPORT_PRIVATE ScriptPreparseCache {
+ public:
+  struct Entry {
+    int start_position;
+    int end_position;
+    int num_parameters;
+    int function_length;
+    int num_inner_functions;
+    bool uses_super_property;
+    LanguageMode language_mode;
+    // Null if the function has no inner functions that need data.
+    ZonePreparseData* preparse_data;
+  };
+
+  explicit ScriptPreparseCache(Zone* zone) : zone_(zone), entries_(zone) {}
+  ScriptPreparseCache(const ScriptPreparseCache&) = delete;
+  ScriptPreparseCache& operator=(const ScriptPreparseCache&) = delete;
+
+  // Adds or replaces the entry for the function starting at
+  // |entry.start_position|. The preparse data must live in zone().
+  void Add(const Entry& entry);
+
+  // Returns the entry for the function starting at |start_position|, or
+  // nullptr if there is none.
+  const Entry* Lookup(int start_position) const;
+
+  Zone* zone() const { return zone_; }
+  int size() const { return static_cast<int>(entries_.size()); }
+
+  // Serializes the cache for a script with the given |source|.
+  std::vector<uint8_t> Serialize(Isolate* isolate, Handle<String> source) const;
+
+  // Returns nullptr if |data| is malformed or was produced by a different V8
+  // version, with different flags, or for a different source.
+  static ScriptPreparseCache* Deserialize(Zone* zone,
+                                          base::Vector<const uint8_t> data,
+                                          Isolate* isolate,
+                                          Handle<String> source);
+
+ private:
+  Zone* zone_;
+  // Sorted by start position.
+  ZoneVector<Entry> entries_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCRIPT_PREPARSE_CACHE_H_
@@ -4,6 +4,9 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <algorithm>
+
+#include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/codegen/interface-descriptors-inl.h"
@@ -14,40 +17,6 @@
 namespace v8 {
 namespace internal {
 
-namespace {
-
-Builtin TryLookupCode(const EmbeddedData& d, Address address) {
-  if (!d.IsInCodeRange(address)) return Builtin::kNoBuiltinId;
-
-  if (address < d.InstructionStartOfBuiltin(static_cast<Builtin>(0))) {
-    return Builtin::kNoBuiltinId;
-  }
-
-  // Note: Addresses within the padding section between builtins (i.e. within
-  // start + size <= address < start + padded_size) are interpreted as belonging
-  // to the preceding builtin.
-
-  int l = 0, r = Builtins::kBuiltinCount;
-  while (l < r) {
-    const int mid = (l + r) / 2;
-    const Builtin builtin = Builtins::FromInt(mid);
-    Address start = d.InstructionStartOfBuiltin(builtin);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
-
-    if (address < start) {
-      r = mid;
-    } else if (address >= end) {
-      l = mid + 1;
-    } else {
-      return builtin;
-    }
-  }
-
-  UNREACHABLE();
-}
-
-}  // namespace
-
 // static
 bool InstructionStream::PcIsOffHeap(Isolate* isolate, Address pc) {
   // Mksnapshot calls this while the embedded blob is not available yet.
@@ -89,11 +58,11 @@ Builtin InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (isolate->embedded_blob_code() == nullptr) return Builtin::kNoBuiltinId;
   DCHECK_NOT_NULL(Isolate::CurrentEmbeddedBlobCode());
 
-  Builtin builtin = i::TryLookupCode(EmbeddedData::FromBlob(isolate), address);
+  Builtin builtin = EmbeddedData::FromBlob(isolate).TryLookupCode(address);
 
   if (isolate->is_short_builtin_calls_enabled() &&
       !Builtins::IsBuiltinId(builtin)) {
-    builtin = i::TryLookupCode(EmbeddedData::FromBlob(), address);
+    builtin = EmbeddedData::FromBlob().TryLookupCode(address);
   }
   return builtin;
 }
@@ -250,21 +219,61 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns how often each builtin was called in the profile given by
+// --turbo-profiling-log-file, indexed by builtin ID.
+std::vector<double> ReadBuiltinExecutionCounts() {
+  std::vector<double> execution_counts(Builtins::kBuiltinCount, 0);
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    const ProfileDataFromFile* profile_data =
+        ProfileDataFromFile::TryRead(Builtins::name(builtin));
+    if (profile_data == nullptr) continue;
+    execution_counts[Builtins::ToInt(builtin)] =
+        profile_data->GetExecutionCount();
+  }
+  return execution_counts;
+}
+
 }  // namespace
 
+// static
+std::vector<Builtin> EmbeddedData::BuiltinLayoutOrder(
+    const std::vector<double>& execution_counts) {
+  std::vector<Builtin> order;
+  order.reserve(Builtins::kBuiltinCount);
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    order.push_back(builtin);
+  }
+  if (execution_counts.empty()) return order;
+
+  DCHECK_EQ(execution_counts.size(),
+            static_cast<size_t>(Builtins::kBuiltinCount));
+  auto bytecode_handlers_begin =
+      order.begin() + Builtins::ToInt(Builtin::kFirstBytecodeHandler);
+  std::stable_sort(order.begin(), bytecode_handlers_begin,
+                   [&](Builtin a, Builtin b) {
+                     return execution_counts[Builtins::ToInt(a)] <
+                            execution_counts[Builtins::ToInt(b)];
+                   });
+  return order;
+}
+
 // static
 EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   Builtins* builtins = isolate->builtins();
 
   // Store instruction stream lengths and offsets.
   std::vector<struct LayoutDescription> layout_descriptions(kTableSize);
+  const std::vector<Builtin> layout_order =
+      BuiltinLayoutOrder(FLAG_reorder_builtins ? ReadBuiltinExecutionCounts()
+                                               : std::vector<double>());
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_code_size = 0;
   uint32_t raw_data_size = 0;
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
+  for (Builtin builtin : layout_order) {
     Code code = builtins->code(builtin);
 
     // Sanity-check that the given builtin is isolate-independent and does not
@@ -328,6 +337,15 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   std::memcpy(blob_data + LayoutDescriptionTableOffset(),
               layout_descriptions.data(), LayoutDescriptionTableSize());
 
+  // .. and the builtin layout table.
+  {
+    uint32_t* const layout_table =
+        reinterpret_cast<uint32_t*>(blob_data + BuiltinLayoutTableOffset());
+    for (size_t i = 0; i < layout_order.size(); i++) {
+      layout_table[i] = static_cast<uint32_t>(Builtins::ToInt(layout_order[i]));
+    }
+  }
+
   // .. and the variable-size data section.
   uint8_t* const raw_metadata_start = blob_data + RawMetadataOffset();
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
@@ -386,6 +404,36 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   return d;
 }
 
+Builtin EmbeddedData::TryLookupCode(Address address) const {
+  if (!IsInCodeRange(address)) return Builtin::kNoBuiltinId;
+
+  if (address < InstructionStartOfBuiltin(BuiltinAtLayoutPosition(0))) {
+    return Builtin::kNoBuiltinId;
+  }
+
+  // Note: Addresses within the padding section between builtins (i.e. within
+  // start + size <= address < start + padded_size) are interpreted as belonging
+  // to the preceding builtin.
+
+  int l = 0, r = Builtins::kBuiltinCount;
+  while (l < r) {
+    const int mid = (l + r) / 2;
+    const Builtin builtin = BuiltinAtLayoutPosition(mid);
+    Address start = InstructionStartOfBuiltin(builtin);
+    Address end = start + PaddedInstructionSizeOfBuiltin(builtin);
+
+    if (address < start) {
+      r = mid;
+    } else if (address >= end) {
+      l = mid + 1;
+    } else {
+      return builtin;
+    }
+  }
+
+  UNREACHABLE();
+}
+
 Address EmbeddedData::InstructionStartOfBuiltin(Builtin builtin) const {
   DCHECK(Builtins::IsBuiltinId(builtin));
   const struct LayoutDescription* descs = LayoutDescription();
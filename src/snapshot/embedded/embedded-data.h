@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_EMBEDDED_EMBEDDED_DATA_H_
 #define V8_SNAPSHOT_EMBEDDED_EMBEDDED_DATA_H_
 
+#include <vector>
+
 #include "src/base/macros.h"
 #include "src/builtins/builtins.h"
 #include "src/common/globals.h"
@@ -50,6 +52,15 @@ class EmbeddedData final {
  public:
   static EmbeddedData FromIsolate(Isolate* isolate);
 
+  // Returns the order in which builtins are placed in the code section. This
+  // is the order of builtin IDs if {execution_counts} is empty. Otherwise all
+  // builtins but the bytecode handlers are sorted by their execution count
+  // (indexed by builtin ID), from least to most frequently called. The
+  // bytecode handlers always come last and in ID order, so that the hottest
+  // builtins end up on the same pages as the interpreter.
+  static std::vector<Builtin> BuiltinLayoutOrder(
+      const std::vector<double>& execution_counts);
+
   static EmbeddedData FromBlob() {
     return EmbeddedData(Isolate::CurrentEmbeddedBlobCode(),
                         Isolate::CurrentEmbeddedBlobCodeSize(),
@@ -108,6 +119,10 @@ class EmbeddedData final {
     data_ = nullptr;
   }
 
+  // Returns the builtin whose (padded) instruction area contains {address},
+  // or kNoBuiltinId if there is none.
+  Builtin TryLookupCode(Address address) const;
+
   Address InstructionStartOfBuiltin(Builtin builtin) const;
   uint32_t InstructionSizeOfBuiltin(Builtin builtin) const;
 
@@ -117,6 +132,15 @@ class EmbeddedData final {
   Address MetadataStartOfBuiltin(Builtin builtin) const;
   uint32_t MetadataSizeOfBuiltin(Builtin builtin) const;
 
+  // Returns the builtin at {position} in the code section, i.e. builtins
+  // are returned in increasing order of their instruction start. This is the
+  // order of builtin IDs unless the blob was created with --reorder-builtins.
+  Builtin BuiltinAtLayoutPosition(int position) const {
+    DCHECK_LE(0, position);
+    DCHECK_LT(position, Builtins::kBuiltinCount);
+    return Builtins::FromInt(BuiltinLayoutTable()[position]);
+  }
+
   uint32_t AddressForHashing(Address addr) {
     DCHECK(IsInCodeRange(addr));
     Address start = reinterpret_cast<Address>(code_);
@@ -176,6 +200,8 @@ class EmbeddedData final {
   // [2] hash of embedded-blob-relevant heap objects
   // [3] layout description of instruction stream 0
   // ... layout descriptions
+  // [y] id of the builtin at layout position 0
+  // ... builtin ids in layout order
   // [x] metadata section of builtin 0
   // ... metadata sections
   //
@@ -200,9 +226,15 @@ class EmbeddedData final {
   static constexpr uint32_t LayoutDescriptionTableSize() {
     return sizeof(struct LayoutDescription) * kTableSize;
   }
-  static constexpr uint32_t FixedDataSize() {
+  static constexpr uint32_t BuiltinLayoutTableOffset() {
     return LayoutDescriptionTableOffset() + LayoutDescriptionTableSize();
   }
+  static constexpr uint32_t BuiltinLayoutTableSize() {
+    return kUInt32Size * kTableSize;
+  }
+  static constexpr uint32_t FixedDataSize() {
+    return BuiltinLayoutTableOffset() + BuiltinLayoutTableSize();
+  }
   // The variable-size data section starts here.
   static constexpr uint32_t RawMetadataOffset() { return FixedDataSize(); }
 
@@ -210,6 +242,8 @@ class EmbeddedData final {
   static constexpr uint32_t RawCodeOffset() { return 0; }
 
  private:
+  friend class EmbeddedDataTest;
+
   EmbeddedData(const uint8_t* code, uint32_t code_size, const uint8_t* data,
                uint32_t data_size)
       : code_(code), code_size_(code_size), data_(data), data_size_(data_size) {
@@ -225,6 +259,10 @@ class EmbeddedData final {
     return reinterpret_cast<const struct LayoutDescription*>(
         data_ + LayoutDescriptionTableOffset());
   }
+  const uint32_t* BuiltinLayoutTable() const {
+    return reinterpret_cast<const uint32_t*>(data_ +
+                                             BuiltinLayoutTableOffset());
+  }
   const uint8_t* RawMetadata() const { return data_ + RawMetadataOffset(); }
 
   static constexpr int PadAndAlignCode(int size) {
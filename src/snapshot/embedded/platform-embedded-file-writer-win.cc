@@ -111,8 +111,9 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   {
     STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
     Address prev_builtin_end_offset = 0;
-    for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-         ++builtin) {
+    // PDATA entries must be sorted by address.
+    for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+      const Builtin builtin = blob->BuiltinAtLayoutPosition(i);
       const int builtin_index = static_cast<int>(builtin);
       // Some builtins are leaf functions from the point of view of Win64 stack
       // walking: they do not move the stack pointer and do not require a PDATA
@@ -197,8 +198,9 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   std::vector<win64_unwindinfo::FrameOffsets> fp_adjustments;
 
   STATIC_ASSERT(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
+  // PDATA entries must be sorted by address.
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    const Builtin builtin = blob->BuiltinAtLayoutPosition(i);
     const int builtin_index = static_cast<int>(builtin);
     if (unwind_infos[builtin_index].is_leaf_function()) continue;
 
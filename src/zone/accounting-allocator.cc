@@ -4,12 +4,16 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -64,8 +68,158 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
   return allocator;
 }
 
+// The shard of SegmentPool free lists used by the current thread, assigned
+// round-robin when the thread first uses a pool.
+thread_local int current_segment_pool_shard = -1;
+std::atomic<int> next_segment_pool_shard{0};
+
 }  // namespace
 
+// Keeps unused segments of the sizes that zones grow through in free lists by
+// size. The free lists are split into shards picked by the calling thread, so
+// that concurrent compile jobs sharing an allocator rarely contend on the same
+// lock.
+class SegmentPool final {
+ public:
+  explicit SegmentPool(size_t max_size) : max_size_(max_size) {}
+  SegmentPool(const SegmentPool&) = delete;
+  SegmentPool& operator=(const SegmentPool&) = delete;
+  ~SegmentPool() { DCHECK_EQ(0, size()); }
+
+  // Returns whether segments of |bytes| bytes are pooled.
+  static bool IsPooledSize(size_t bytes) {
+    return SizeClassIndex(bytes) != kNumSizeClasses;
+  }
+
+  // Returns a segment of |bytes| bytes, or nullptr if there is none. Tries the
+  // shard of the current thread first and then the others.
+  Segment* Get(size_t bytes) {
+    DCHECK(IsPooledSize(bytes));
+    if (size() == 0) return nullptr;
+    int size_class_index = SizeClassIndex(bytes);
+    int shard_index = CurrentShardIndex();
+    for (int i = 0; i < kNumShards; i++) {
+      Shard& shard = shards_[(shard_index + i) % kNumShards];
+      FreeList& list = shard.free_lists[size_class_index];
+      base::MutexGuard guard(&shard.mutex);
+      Segment* segment = list.head;
+      if (segment == nullptr) continue;
+      list.head = segment->next();
+      list.length--;
+      list.low_water_mark = std::min(list.low_water_mark, list.length);
+      size_.fetch_sub(bytes, std::memory_order_relaxed);
+      return segment;
+    }
+    return nullptr;
+  }
+
+  // Adds |segment| to the pool. Returns false if the segment is not of a
+  // pooled size or the pool is full.
+  bool Put(Segment* segment) {
+    size_t bytes = segment->total_size();
+    if (!IsPooledSize(bytes)) return false;
+    if (size_.fetch_add(bytes, std::memory_order_relaxed) + bytes >
+        max_size_) {
+      size_.fetch_sub(bytes, std::memory_order_relaxed);
+      return false;
+    }
+    Shard& shard = shards_[CurrentShardIndex()];
+    FreeList& list = shard.free_lists[SizeClassIndex(bytes)];
+    base::MutexGuard guard(&shard.mutex);
+    segment->set_next(list.head);
+    list.head = segment;
+    list.length++;
+    return true;
+  }
+
+  // Frees the segments that stayed in the pool since the previous trim, i.e.
+  // the ones below the lowest fill level of each free list, or all segments
+  // if |release_all| is set.
+  void Trim(ZoneBackingAllocator::FreeFn free_fn, bool release_all) {
+    for (Shard& shard : shards_) {
+      Segment* unused = nullptr;
+      {
+        base::MutexGuard guard(&shard.mutex);
+        for (FreeList& list : shard.free_lists) {
+          size_t keep = release_all ? 0 : list.length - list.low_water_mark;
+          Segment* last_kept = nullptr;
+          Segment* rest = list.head;
+          for (size_t i = 0; i < keep; i++) {
+            last_kept = rest;
+            rest = rest->next();
+          }
+          if (last_kept == nullptr) {
+            list.head = nullptr;
+          } else {
+            last_kept->set_next(nullptr);
+          }
+          while (rest != nullptr) {
+            Segment* next = rest->next();
+            rest->set_next(unused);
+            unused = rest;
+            rest = next;
+          }
+          list.length = keep;
+          list.low_water_mark = keep;
+        }
+      }
+      // Free outside of the lock.
+      while (unused != nullptr) {
+        Segment* next = unused->next();
+        size_.fetch_sub(unused->total_size(), std::memory_order_relaxed);
+        unused->ZapHeader();
+        free_fn(unused);
+        unused = next;
+      }
+    }
+  }
+
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+ private:
+  // The segment sizes a zone requests most: Zone::kMinimumSegmentSize for its
+  // first segment and Zone::kMaximumSegmentSize once it has grown. Segments of
+  // other sizes are allocated at their exact size and not pooled, so pooling
+  // never makes a zone use more memory.
+  static constexpr size_t kSizeClasses[] = {8 * KB, 32 * KB};
+  static constexpr int kNumSizeClasses = arraysize(kSizeClasses);
+  static constexpr int kNumShards = 8;
+
+  struct FreeList {
+    Segment* head = nullptr;
+    size_t length = 0;
+    // The lowest length since the previous trim.
+    size_t low_water_mark = 0;
+  };
+
+  struct Shard {
+    base::Mutex mutex;
+    FreeList free_lists[kNumSizeClasses];
+  };
+
+  // Returns kNumSizeClasses if segments of |bytes| bytes are not pooled.
+  static int SizeClassIndex(size_t bytes) {
+    int index = 0;
+    while (index < kNumSizeClasses && kSizeClasses[index] != bytes) index++;
+    return index;
+  }
+
+  static int CurrentShardIndex() {
+    if (V8_UNLIKELY(current_segment_pool_shard < 0)) {
+      current_segment_pool_shard =
+          next_segment_pool_shard.fetch_add(1, std::memory_order_relaxed) %
+          kNumShards;
+    }
+    return current_segment_pool_shard;
+  }
+
+  const size_t max_size_;
+  std::atomic<size_t> size_{0};
+  Shard shards_[kNumShards];
+};
+
+constexpr size_t SegmentPool::kSizeClasses[];
+
 AccountingAllocator::AccountingAllocator()
     : zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
@@ -78,9 +232,12 @@ AccountingAllocator::AccountingAllocator()
     bounded_page_allocator_ = CreateBoundedAllocator(platform_page_allocator,
                                                      reserved_area_->address());
   }
+  if (FLAG_zone_segment_pool_size > 0) {
+    segment_pool_ = std::make_unique<SegmentPool>(FLAG_zone_segment_pool_size);
+  }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -91,7 +248,11 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
-    memory = AllocWithRetry(bytes, zone_backing_malloc_);
+    memory = nullptr;
+    if (segment_pool_ && SegmentPool::IsPooledSize(bytes)) {
+      memory = segment_pool_->Get(bytes);
+    }
+    if (memory == nullptr) memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
   if (memory == nullptr) return nullptr;
 
@@ -111,12 +272,26 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
-  } else {
-    zone_backing_free_(segment);
+    return;
   }
+  if (segment_pool_ && segment_pool_->Put(segment)) return;
+  segment->ZapHeader();
+  zone_backing_free_(segment);
+}
+
+size_t AccountingAllocator::GetPooledMemoryUsage() const {
+  return segment_pool_ ? segment_pool_->size() : 0;
+}
+
+void AccountingAllocator::TrimSegmentPool() {
+  if (segment_pool_) segment_pool_->Trim(zone_backing_free_, false);
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  if (segment_pool_) segment_pool_->Trim(zone_backing_free_, true);
 }
 
 }  // namespace internal
@@ -21,6 +21,7 @@ class BoundedPageAllocator;
 namespace internal {
 
 class Segment;
+class SegmentPool;
 class VirtualMemory;
 class Zone;
 
@@ -46,6 +47,16 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Returns the number of bytes held by unused segments in the pool. These are
+  // not included in GetCurrentMemoryUsage().
+  size_t GetPooledMemoryUsage() const;
+
+  // Releases pooled segments that were not reused since the previous call.
+  void TrimSegmentPool();
+
+  // Releases all pooled segments, e.g. under memory pressure.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -70,6 +81,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  // Unused segments of the common zone segment sizes, kept for reuse to
+  // avoid round trips through malloc. Only segments that don't support
+  // compression are pooled.
+  std::unique_ptr<SegmentPool> segment_pool_;
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
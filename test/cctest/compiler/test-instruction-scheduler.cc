@@ -6,6 +6,7 @@
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -50,6 +51,10 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  Instruction* InstructionAt(int index) {
+    return sequence_.InstructionAt(index);
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -107,6 +112,55 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+#if V8_TARGET_ARCH_X64
+TEST(LoadsAreScheduledEarly) {
+  // The generic model doesn't know about load latencies. The model is picked
+  // on first use, so this has to happen before anything is scheduled.
+  FlagScope<const char*> mcpu_scope(&FLAG_mcpu, "core");
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  tester.StartBlock();
+  InstructionOperand base(
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0));
+  InstructionOperand loaded(
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1));
+  InstructionOperand sum(
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2));
+  InstructionOperand other(
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 3));
+  InstructionOperand other_sum(
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 4));
+
+  // other_sum = other + other
+  InstructionOperand other_inputs[] = {other, other};
+  Instruction* independent_inst =
+      Instruction::New(zone, kX64Add32, 1, &other_sum, 2, other_inputs, 0,
+                       nullptr);
+  tester.AddInstruction(independent_inst);
+  // loaded = [base]
+  Instruction* load_inst =
+      Instruction::New(zone, kX64Movl | AddressingModeField::encode(kMode_MR),
+                       1, &loaded, 1, &base, 0, nullptr);
+  tester.AddInstruction(load_inst);
+  // sum = loaded + loaded
+  InstructionOperand use_inputs[] = {loaded, loaded};
+  Instruction* use_inst =
+      Instruction::New(zone, kX64Add32, 1, &sum, 2, use_inputs, 0, nullptr);
+  tester.AddInstruction(use_inst);
+  Instruction* ret_inst = Instruction::New(zone, kArchRet);
+  tester.AddTerminator(ret_inst);
+  tester.EndBlock();
+
+  // The load is on the critical path, so it is issued first and the
+  // independent addition fills part of its latency.
+  CHECK_EQ(load_inst, tester.InstructionAt(0));
+  CHECK_EQ(independent_inst, tester.InstructionAt(1));
+  CHECK_EQ(use_inst, tester.InstructionAt(2));
+  CHECK_EQ(ret_inst, tester.InstructionAt(3));
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
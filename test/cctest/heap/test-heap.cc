@@ -1164,6 +1164,71 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOnce) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_flush_bytecode_once = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+    CHECK(!function->shared().bytecode_was_flushed());
+
+    // Simulate several GCs that use full marking.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold + 2; i++) {
+      CcTest::CollectAllGarbage();
+    }
+
+    // The first time around the bytecode is flushed as usual.
+    CHECK(!function->shared().is_compiled());
+    CHECK(function->shared().bytecode_was_flushed());
+
+    // Call foo to get it recompiled.
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+
+    // Once recompiled the bytecode is kept, however old it gets.
+    for (int i = 0; i < kAgingThreshold + 2; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
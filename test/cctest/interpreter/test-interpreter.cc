@@ -5,6 +5,7 @@
 #include <tuple>
 
 #include "src/api/api-inl.h"
+#include "src/base/ieee754.h"
 #include "src/base/overflowing-math.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/execution.h"
@@ -242,6 +243,8 @@ static double BinaryOpC(Token::Value op, double lhs, double rhs) {
       return base::Divide(lhs, rhs);
     case Token::Value::MOD:
       return Modulo(lhs, rhs);
+    case Token::Value::EXP:
+      return base::ieee754::pow(lhs, rhs);
     case Token::Value::BIT_OR:
       return (v8::internal::DoubleToInt32(lhs) |
               v8::internal::DoubleToInt32(rhs));
@@ -347,6 +350,92 @@ TEST(InterpreterBinaryOpsSmi) {
   }
 }
 
+// Binary operations are followed by a short Star, which their handlers
+// dispatch to without going through the dispatch table (see
+// Bytecodes::IsStarLookahead). The Star must still store the result.
+TEST(InterpreterBinaryOpsStarLookahead) {
+  static const struct {
+    Token::Value op;
+    Bytecode bytecode;
+    Bytecode smi_bytecode;
+  } kOperators[] = {
+      {Token::Value::BIT_OR, Bytecode::kBitwiseOr, Bytecode::kBitwiseOrSmi},
+      {Token::Value::BIT_XOR, Bytecode::kBitwiseXor, Bytecode::kBitwiseXorSmi},
+      {Token::Value::BIT_AND, Bytecode::kBitwiseAnd, Bytecode::kBitwiseAndSmi},
+      {Token::Value::SHL, Bytecode::kShiftLeft, Bytecode::kShiftLeftSmi},
+      {Token::Value::SAR, Bytecode::kShiftRight, Bytecode::kShiftRightSmi},
+      {Token::Value::SHR, Bytecode::kShiftRightLogical,
+       Bytecode::kShiftRightLogicalSmi},
+      {Token::Value::ADD, Bytecode::kAdd, Bytecode::kAddSmi},
+      {Token::Value::SUB, Bytecode::kSub, Bytecode::kSubSmi},
+      {Token::Value::MUL, Bytecode::kMul, Bytecode::kMulSmi},
+      {Token::Value::DIV, Bytecode::kDiv, Bytecode::kDivSmi},
+      {Token::Value::MOD, Bytecode::kMod, Bytecode::kModSmi},
+      {Token::Value::EXP, Bytecode::kExp, Bytecode::kExpSmi}};
+  int lhs_inputs[] = {7, -18000, 0};
+  int rhs_inputs[] = {3, -2};
+  for (size_t l = 0; l < arraysize(lhs_inputs); l++) {
+    for (size_t r = 0; r < arraysize(rhs_inputs); r++) {
+      for (size_t o = 0; o < arraysize(kOperators); o++) {
+        for (bool smi_literal : {false, true}) {
+          HandleAndZoneScope handles;
+          Isolate* isolate = handles.main_isolate();
+          Zone* zone = handles.main_zone();
+          Factory* factory = isolate->factory();
+          FeedbackVectorSpec feedback_spec(zone);
+          BytecodeArrayBuilder builder(zone, 1, 2, &feedback_spec);
+
+          FeedbackSlot slot = feedback_spec.AddBinaryOpICSlot();
+          Handle<i::FeedbackMetadata> metadata =
+              NewFeedbackMetadata(isolate, &feedback_spec);
+
+          Token::Value op = kOperators[o].op;
+          Register lhs_reg(0);
+          Register result_reg(1);
+          int lhs = lhs_inputs[l];
+          int rhs = rhs_inputs[r];
+          if (smi_literal) {
+            builder.LoadLiteral(Smi::FromInt(lhs))
+                .BinaryOperationSmiLiteral(op, Smi::FromInt(rhs),
+                                           GetIndex(slot));
+          } else {
+            builder.LoadLiteral(Smi::FromInt(lhs))
+                .StoreAccumulatorInRegister(lhs_reg)
+                .LoadLiteral(Smi::FromInt(rhs))
+                .BinaryOperation(op, lhs_reg, GetIndex(slot));
+          }
+          // Clobber the accumulator so that the Star is actually emitted.
+          builder.StoreAccumulatorInRegister(result_reg)
+              .LoadUndefined()
+              .LoadAccumulatorWithRegister(result_reg)
+              .Return();
+          Handle<BytecodeArray> bytecode_array =
+              builder.ToBytecodeArray(isolate);
+
+          // Check that the operation is immediately followed by Star1.
+          Bytecode producer = Bytecode::kIllegal;
+          for (BytecodeArrayIterator it(bytecode_array); !it.done();
+               it.Advance()) {
+            if (it.current_bytecode() == Bytecode::kStar1) break;
+            producer = it.current_bytecode();
+          }
+          CHECK_EQ(smi_literal ? kOperators[o].smi_bytecode
+                               : kOperators[o].bytecode,
+                   producer);
+          CHECK(Bytecodes::IsStarLookahead(producer, OperandScale::kSingle));
+
+          InterpreterTester tester(isolate, bytecode_array, metadata);
+          auto callable = tester.GetCallable<>();
+          Handle<Object> return_value = callable().ToHandleChecked();
+          Handle<Object> expected_value =
+              factory->NewNumber(BinaryOpC(op, lhs, rhs));
+          CHECK(return_value->SameValue(*expected_value));
+        }
+      }
+    }
+  }
+}
+
 TEST(InterpreterBinaryOpsHeapNumber) {
   double lhs_inputs[] = {3266.101, 1024.12, 0.01, -17.99, -18000.833, 9.1e17};
   double rhs_inputs[] = {3266.101, 5.999, 4.778, 3.331,  2.643,
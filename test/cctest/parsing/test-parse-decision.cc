@@ -7,11 +7,13 @@
 // Note that presently most unit tests for parsing are found in
 // cctest/test-parsing.cc.
 
+#include <map>
 #include <unordered_map>
 
 #include "include/v8-local-handle.h"
 #include "include/v8-primitive.h"
 #include "src/api/api-inl.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/objects-inl.h"
@@ -108,5 +110,63 @@ TEST(CommaFunctionSequence) {
   DCHECK(is_compiled["c"]);
 }
 
+TEST(ParallelCompileTasksForTopLevelCalls) {
+  if (!FLAG_lazy) return;
+  FLAG_lazy_compile_dispatcher = true;
+  FLAG_parallel_compile_tasks = true;
+  FLAG_parallel_compile_tasks_for_top_level_calls = true;
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  LocalContext env;
+
+  const char src[] =
+      "function called() { var a; }\n"
+      "called();\n"
+      "hoisted();\n"
+      "function hoisted() { var b; }\n"
+      "function redeclared() { return 1; }\n"
+      "redeclared();\n"
+      "function redeclared() { return 2; }\n"
+      "function not_called() { var c; }\n"
+      "function called_from_function() { var d; }\n"
+      "function caller() { called_from_function(); }\n";
+  Handle<JSFunction> toplevel_fn = v8::Utils::OpenHandle(*v8_compile(src));
+
+  // Record for each function whether a compile task was registered for it,
+  // in source order.
+  LazyCompileDispatcher* dispatcher = isolate->lazy_compile_dispatcher();
+  std::unordered_map<std::string, std::map<int, bool>> is_enqueued;
+  SharedFunctionInfo::ScriptIterator iterator(
+      isolate, Script::cast(toplevel_fn->shared().script()));
+  for (SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+       shared = iterator.Next()) {
+    std::unique_ptr<char[]> name = String::cast(shared.Name()).ToCString();
+    is_enqueued[name.get()][shared.StartPosition()] =
+        dispatcher->IsEnqueued(handle(shared, isolate));
+  }
+
+  // Returns whether a task was posted for the last declaration of {name}.
+  auto last_is_enqueued = [&](const char* name) {
+    CHECK(!is_enqueued[name].empty());
+    return is_enqueued[name].rbegin()->second;
+  };
+  CHECK(last_is_enqueued("called"));
+  CHECK(last_is_enqueued("hoisted"));
+  CHECK(!last_is_enqueued("not_called"));
+  CHECK(!last_is_enqueued("called_from_function"));
+  CHECK(!last_is_enqueued("caller"));
+
+  // Only the last declaration of a name is ever called.
+  CHECK(last_is_enqueued("redeclared"));
+  int enqueued_redeclarations = 0;
+  for (auto& entry : is_enqueued["redeclared"]) {
+    if (entry.second) enqueued_redeclarations++;
+  }
+  CHECK_EQ(1, enqueued_redeclarations);
+
+  dispatcher->AbortAll();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -12,6 +12,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/preparse-data-impl.h"
 #include "src/parsing/preparse-data.h"
+#include "src/parsing/script-preparse-cache.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/scope-test-helper.h"
 #include "test/cctest/unicode-helpers.h"
@@ -771,6 +772,104 @@ TEST(Regress753896) {
                            i::parsing::ReportStatisticsMode::kYes);
 }
 
+namespace {
+
+struct LazyFunctionInfo {
+  int start_position = i::kNoSourcePosition;
+  int end_position = i::kNoSourcePosition;
+  int parameter_count = -1;
+  bool has_preparse_data = false;
+};
+
+// Parses |source| with |cache| and describes the top-level function "lazy".
+LazyFunctionInfo ParseWithPreparseCache(i::Isolate* isolate,
+                                        i::Handle<i::String> source,
+                                        i::ScriptPreparseCache* cache) {
+  i::Handle<i::Script> script = isolate->factory()->NewScript(source);
+  i::UnoptimizedCompileState state(isolate);
+  i::UnoptimizedCompileFlags flags =
+      i::UnoptimizedCompileFlags::ForScriptCompile(isolate, *script);
+  i::ParseInfo info(isolate, flags, &state);
+  info.set_script_preparse_cache(cache);
+  CHECK(i::parsing::ParseProgram(&info, script, isolate,
+                                 i::parsing::ReportStatisticsMode::kYes));
+  LazyFunctionInfo result;
+  for (i::Declaration* decl : *info.literal()->scope()->declarations()) {
+    if (!decl->IsFunctionDeclaration()) continue;
+    if (!decl->var()->raw_name()->IsOneByteEqualTo("lazy")) continue;
+    i::FunctionLiteral* fun = decl->AsFunctionDeclaration()->fun();
+    result.start_position = fun->start_position();
+    result.end_position = fun->end_position();
+    result.parameter_count = fun->parameter_count();
+    result.has_preparse_data = fun->produced_preparse_data() != nullptr;
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(ScriptPreparseCache) {
+  if (!i::FLAG_lazy) return;
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::Factory* factory = isolate->factory();
+  i::HandleScope scope(isolate);
+  LocalContext env;
+
+  i::Handle<i::String> source = factory->InternalizeUtf8String(
+      "function lazy(a, b) { function inner() { return a; } return inner; }\n"
+      "var expression = function() { 'use strict'; return 1; };\n"
+      "function withEval() { eval('1'); }\n"
+      "lazy(1, 2)();");
+
+  // Produce the cache. Functions calling eval are never recorded.
+  LazyFunctionInfo produced;
+  std::vector<uint8_t> data;
+  {
+    i::Zone zone(isolate->allocator(), ZONE_NAME);
+    i::ScriptPreparseCache cache(&zone);
+    produced = ParseWithPreparseCache(isolate, source, &cache);
+    CHECK(produced.has_preparse_data);
+    CHECK_EQ(2, cache.size());
+    const i::ScriptPreparseCache::Entry* entry =
+        cache.Lookup(produced.start_position);
+    CHECK_NOT_NULL(entry);
+    CHECK_EQ(produced.end_position, entry->end_position);
+    CHECK_EQ(2, entry->num_parameters);
+    CHECK_EQ(1, entry->num_inner_functions);
+    CHECK_NOT_NULL(entry->preparse_data);
+    data = cache.Serialize(isolate, source);
+  }
+
+  // Consume it. The skipped function still gets its inner function data.
+  {
+    i::Zone zone(isolate->allocator(), ZONE_NAME);
+    i::base::Vector<const uint8_t> bytes(data.data(), data.size());
+    i::ScriptPreparseCache* cache =
+        i::ScriptPreparseCache::Deserialize(&zone, bytes, isolate, source);
+    CHECK_NOT_NULL(cache);
+    CHECK_EQ(2, cache->size());
+    LazyFunctionInfo consumed = ParseWithPreparseCache(isolate, source, cache);
+    CHECK_EQ(produced.start_position, consumed.start_position);
+    CHECK_EQ(produced.end_position, consumed.end_position);
+    CHECK_EQ(2, consumed.parameter_count);
+    CHECK(consumed.has_preparse_data);
+
+    // Data for another source, or corrupted data, is rejected.
+    i::Handle<i::String> other_source =
+        factory->NewStringFromAsciiChecked("lazy(1, 2)();");
+    CHECK_NULL(i::ScriptPreparseCache::Deserialize(&zone, bytes, isolate,
+                                                   other_source));
+    std::vector<uint8_t> corrupted = data;
+    corrupted.back() ^= 1;
+    CHECK_NULL(i::ScriptPreparseCache::Deserialize(
+        &zone,
+        i::base::Vector<const uint8_t>(corrupted.data(), corrupted.size()),
+        isolate, source));
+    CHECK_NULL(i::ScriptPreparseCache::Deserialize(
+        &zone, bytes.SubVector(0, bytes.size() - 1), isolate, source));
+  }
+}
+
 TEST(ProducingAndConsumingByteData) {
   i::Isolate* isolate = CcTest::i_isolate();
   i::HandleScope scope(isolate);
@@ -320,6 +320,31 @@ TEST(AdvanceMatchAdvanceUntil) {
   }
 }
 
+TEST(AdvanceUntilAnyOfMatchesAdvanceUntil) {
+  // Test that AdvanceUntilAnyOf finds the same characters as AdvanceUntil, at
+  // every offset within and across vector-sized blocks.
+  static constexpr v8::base::uc16 kChars[] = {'*', '\n'};
+  for (size_t match = 0; match < 40; match++) {
+    std::string data(40, 'a');
+    data[match] = (match % 2) ? '*' : '\n';
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream_any_of(
+        v8::internal::ScannerStream::ForTesting(data.c_str(), data.length()));
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream_until(
+        v8::internal::ScannerStream::ForTesting(data.c_str(), data.length()));
+
+    int32_t any_of_c0_ = stream_any_of->AdvanceUntilAnyOf(kChars);
+    int32_t until_c0_ = stream_until->AdvanceUntil(
+        [](int32_t c0_) { return c0_ == '*' || c0_ == '\n'; });
+    CHECK_EQ(until_c0_, any_of_c0_);
+    CHECK_EQ(stream_until->pos(), stream_any_of->pos());
+    CHECK_EQ(match + 1, stream_any_of->pos());
+
+    // No further matches until the end of input.
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream_any_of->AdvanceUntilAnyOf(kChars));
+  }
+}
+
 TEST(Utf8AdvanceUntilOverChunkBoundaries) {
   // Test utf-8 advancing until a certain char, crossing chunk boundaries.
 
@@ -629,6 +654,16 @@ TEST(CharacterStreams) {
   buffer[arraysize(buffer) - 1] = '\0';
   TestCharacterStreams(buffer, arraysize(buffer) - 1);
   TestCharacterStreams(buffer, arraysize(buffer) - 1, 576, 3298);
+
+  // Sources that span many buffer refills.
+  const unsigned large_length = 3 * 4096 + 17;
+  std::unique_ptr<char[]> large_buffer(new char[large_length + 1]);
+  for (unsigned i = 0; i < large_length; i++) {
+    large_buffer[i] = static_cast<char>(i & 0x7F);
+  }
+  large_buffer[large_length] = '\0';
+  TestCharacterStreams(large_buffer.get(), large_length);
+  TestCharacterStreams(large_buffer.get(), large_length, 4000, 9000);
 }
 
 // Regression test for crbug.com/651333. Read invalid utf-8.
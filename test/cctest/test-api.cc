@@ -24141,6 +24141,49 @@ TEST(StreamingWithDebuggingEnabledLate) {
 }
 
 
+TEST(StreamingCompileHints) {
+  i::FLAG_always_opt = false;
+  const char* chunks[] = {"function lazy() { return 1; }",
+                          "function eager() { return 2; }", nullptr};
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  int eager_position =
+      static_cast<int>(strstr(full_source, "function eager") - full_source);
+
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::ScriptCompiler::StreamedSource source(
+      std::make_unique<TestSourceStream>(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE, {eager_position});
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreaming(isolate, &source);
+  task->Run();
+  delete task;
+
+  v8::ScriptOrigin origin(isolate, v8_str("http://foo.com"));
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                  origin)
+          .ToLocalChecked();
+  script->Run(env.local()).ToLocalChecked();
+
+  // The hinted function was compiled on the streaming thread, the other one
+  // is left for lazy compilation.
+  i::Handle<i::JSFunction> eager = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()
+                                 ->Get(env.local(), v8_str("eager"))
+                                 .ToLocalChecked()));
+  i::Handle<i::JSFunction> lazy = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()
+                                 ->Get(env.local(), v8_str("lazy"))
+                                 .ToLocalChecked()));
+  CHECK(eager->shared().is_compiled());
+  CHECK(!lazy->shared().is_compiled());
+
+  delete[] full_source;
+}
+
 TEST(StreamingScriptWithInvalidUtf8) {
   // Regression test for a crash: test that invalid UTF-8 bytes in the end of a
   // chunk don't produce a crash.
@@ -24996,6 +25039,135 @@ TEST(InvalidCodeCacheData) {
 }
 
 
+TEST(InvalidPreparseCacheData) {
+  v8::V8::Initialize();
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext context;
+  TestInvalidCacheData(v8::ScriptCompiler::kConsumePreparseCache);
+}
+
+
+namespace {
+
+int preparse_cache_skipped = 0;
+
+int* LookupPreparseCacheCounter(const char* name) {
+  if (strcmp(name, "c:V8.TotalPreparseCacheSkipped") == 0) {
+    return &preparse_cache_skipped;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(PreparseCache) {
+  if (!i::FLAG_lazy) return;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  const char* source =
+      "function lazy(a, b) { function inner() { return a + b; } return inner; }"
+      "function unused() { return 1; }"
+      "lazy(1, 2)();";
+  // The same length as {source}, with one character of {inner} changed.
+  const char* edited_source =
+      "function lazy(a, b) { function inner() { return a - b; } return inner; }"
+      "function unused() { return 1; }"
+      "lazy(1, 2)();";
+  CHECK_EQ(strlen(source), strlen(edited_source));
+  const char* origin = "preparse cache test";
+  std::vector<uint8_t> cache;
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope cscope(context);
+    v8::ScriptOrigin script_origin(isolate1, v8_str(origin));
+    v8::ScriptCompiler::Source script_source(v8_str(source), script_origin);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context, &script_source,
+                                    v8::ScriptCompiler::kProducePreparseCache)
+            .ToLocalChecked();
+    const v8::ScriptCompiler::CachedData* cached_data =
+        script_source.GetCachedData();
+    CHECK_NOT_NULL(cached_data);
+    CHECK_LT(0, cached_data->length);
+    cache.assign(cached_data->data, cached_data->data + cached_data->length);
+    CHECK_EQ(3, script->Run(context)
+                    .ToLocalChecked()
+                    ->Int32Value(context)
+                    .FromJust());
+  }
+  isolate1->Dispose();
+
+  create_params.counter_lookup_callback = LookupPreparseCacheCounter;
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope cscope(context);
+    v8::ScriptOrigin script_origin(isolate2, v8_str(origin));
+
+    // The cache is accepted for the source it was produced for, and the
+    // recorded functions are skipped without preparsing them.
+    preparse_cache_skipped = 0;
+    v8::ScriptCompiler::CachedData* cached_data =
+        new v8::ScriptCompiler::CachedData(cache.data(),
+                                           static_cast<int>(cache.size()));
+    v8::ScriptCompiler::Source script_source(v8_str(source), script_origin,
+                                             cached_data);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(context, &script_source,
+                                    v8::ScriptCompiler::kConsumePreparseCache)
+            .ToLocalChecked();
+    CHECK(!cached_data->rejected);
+    CHECK_LT(0, preparse_cache_skipped);
+    CHECK_EQ(3, script->Run(context)
+                    .ToLocalChecked()
+                    ->Int32Value(context)
+                    .FromJust());
+
+    // ... and rejected for a different source, even one of the same length.
+    preparse_cache_skipped = 0;
+    v8::ScriptCompiler::CachedData* edited_cached_data =
+        new v8::ScriptCompiler::CachedData(cache.data(),
+                                           static_cast<int>(cache.size()));
+    v8::ScriptCompiler::Source edited_script_source(
+        v8_str(edited_source), script_origin, edited_cached_data);
+    script = v8::ScriptCompiler::Compile(
+                 context, &edited_script_source,
+                 v8::ScriptCompiler::kConsumePreparseCache)
+                 .ToLocalChecked();
+    CHECK(edited_cached_data->rejected);
+    CHECK_EQ(0, preparse_cache_skipped);
+    CHECK_EQ(-1, script->Run(context)
+                     .ToLocalChecked()
+                     ->Int32Value(context)
+                     .FromJust());
+
+    v8::ScriptCompiler::CachedData* other_cached_data =
+        new v8::ScriptCompiler::CachedData(cache.data(),
+                                           static_cast<int>(cache.size()));
+    v8::ScriptCompiler::Source other_source(v8_str("lazy(3, 4)();"),
+                                            script_origin, other_cached_data);
+    script = v8::ScriptCompiler::Compile(
+                 context, &other_source,
+                 v8::ScriptCompiler::kConsumePreparseCache)
+                 .ToLocalChecked();
+    CHECK(other_cached_data->rejected);
+    CHECK_EQ(0, preparse_cache_skipped);
+    CHECK_EQ(-1, script->Run(context)
+                     .ToLocalChecked()
+                     ->Int32Value(context)
+                     .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+
 TEST(StringConcatOverflow) {
   v8::V8::Initialize();
   v8::Isolate* isolate = CcTest::isolate();
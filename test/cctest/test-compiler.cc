@@ -29,6 +29,7 @@
 #include <wchar.h>
 
 #include <memory>
+#include <vector>
 
 #include "include/v8-function.h"
 #include "include/v8-local-handle.h"
@@ -864,6 +865,101 @@ TEST(DeepEagerCompilation) {
   }
 }
 
+TEST(CompileHintsMagicComment) {
+  i::FLAG_always_opt = false;
+  i::FLAG_compile_hints_magic = true;
+  CcTest::InitializeVM();
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::String> source = v8_str(
+      "function lazy() { return 1; }\n"
+      "//# allFunctionsCalledOnLoad\n"
+      "function f(x) {"
+      "  function g(x) {"
+      "    return x * x;"
+      "  }"
+      "  return g(x) + g(x);"
+      "}"
+      "var h = (x) => x + 1;"
+      "f(2) + h(1)");
+  v8::ScriptCompiler::Source script_source(source);
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &script_source).ToLocalChecked();
+  {
+    v8::internal::DisallowCompilation no_compile_expected(isolate);
+    v8::Local<v8::Value> result = script->Run(env.local()).ToLocalChecked();
+    CHECK_EQ(10, result->Int32Value(env.local()).FromJust());
+  }
+  // Functions before the comment are still compiled lazily.
+  Handle<JSFunction> lazy = Handle<JSFunction>::cast(GetGlobalProperty("lazy"));
+  CHECK(!lazy->shared().is_compiled());
+}
+
+TEST(CompileHints) {
+  i::FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function lazy() { return 1; }"
+      "function f(x) {"
+      "  function g(x) {"
+      "    return x * x;"
+      "  }"
+      "  return g(x) + g(x);"
+      "}"
+      "var h = (x) => x + 1;"
+      "f(2) + h(1)";
+  std::vector<int32_t> compile_hints = {
+      static_cast<int32_t>(strstr(source, "(x) =>") - source),
+      static_cast<int32_t>(strstr(source, "function f") - source),
+      static_cast<int32_t>(strstr(source, "function g") - source)};
+  v8::ScriptCompiler::CachedData* cached_data =
+      new v8::ScriptCompiler::CachedData(
+          reinterpret_cast<const uint8_t*>(compile_hints.data()),
+          static_cast<int>(compile_hints.size() * sizeof(int32_t)));
+  v8::ScriptCompiler::Source script_source(v8_str(source), cached_data);
+  v8::Local<v8::Script> script =
+      v8::ScriptCompiler::Compile(env.local(), &script_source,
+                                  v8::ScriptCompiler::kConsumeCompileHints)
+          .ToLocalChecked();
+  CHECK(!cached_data->rejected);
+  {
+    v8::internal::DisallowCompilation no_compile_expected(isolate);
+    v8::Local<v8::Value> result = script->Run(env.local()).ToLocalChecked();
+    CHECK_EQ(10, result->Int32Value(env.local()).FromJust());
+  }
+  // Functions without a hint are still compiled lazily.
+  Handle<JSFunction> lazy = Handle<JSFunction>::cast(GetGlobalProperty("lazy"));
+  CHECK(!lazy->shared().is_compiled());
+}
+
+TEST(CompileHintsRejected) {
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+  const int32_t negative_position = -1;
+  const uint8_t* invalid_data[] = {
+      // Not a whole number of positions.
+      reinterpret_cast<const uint8_t*>("abc"),
+      reinterpret_cast<const uint8_t*>(&negative_position)};
+  const int invalid_length[] = {3, sizeof(negative_position)};
+  for (size_t i = 0; i < arraysize(invalid_data); ++i) {
+    v8::ScriptCompiler::CachedData* cached_data =
+        new v8::ScriptCompiler::CachedData(invalid_data[i], invalid_length[i]);
+    v8::ScriptCompiler::Source script_source(v8_str("6 * 7"), cached_data);
+    v8::Local<v8::Script> script =
+        v8::ScriptCompiler::Compile(env.local(), &script_source,
+                                    v8::ScriptCompiler::kConsumeCompileHints)
+            .ToLocalChecked();
+    CHECK(cached_data->rejected);
+    v8::Local<v8::Value> result = script->Run(env.local()).ToLocalChecked();
+    CHECK_EQ(42, result->Int32Value(env.local()).FromJust());
+  }
+}
+
 TEST(DeepEagerCompilationPeakMemory) {
   i::FLAG_always_opt = false;
   CcTest::InitializeVM();
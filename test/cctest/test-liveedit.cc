@@ -558,5 +558,78 @@ TEST(LiveEditFunctionExpression) {
     CHECK_NOT_NULL(strstr(*new_result_utf8, "Capybara"));
   }
 }
+
+TEST(LiveEditUnchangedFunctionsAreNotCompiled) {
+  const char* original_source =
+      "function bar() { return 2; }\n"
+      "bar();\n"
+      "function foo() { return 1; }\n"
+      "function outer() { function inner() { return 3; } return inner; }\n";
+  const char* updated_source =
+      "function bar() { return 2 + 40; }\n"
+      "bar();\n"
+      "function foo() { return 1; }\n"
+      "function outer() { function inner() { return 3; } return inner; }\n";
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::Local<v8::Context> context = env.local();
+  v8::Isolate* isolate = context->GetIsolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(context, v8_str(isolate, original_source))
+          .ToLocalChecked();
+  script->Run(context).ToLocalChecked();
+  i::Handle<i::Script> i_script(
+      i::Script::cast(v8::Utils::OpenHandle(*script)->shared().script()),
+      i_isolate);
+  i::Handle<i::JSFunction> foo = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("foo")));
+  i::Handle<i::SharedFunctionInfo> foo_shared(foo->shared(), i_isolate);
+  CHECK(!foo_shared->is_compiled());
+
+  debug::LiveEditResult result;
+  LiveEdit::PatchScript(
+      i_isolate, i_script,
+      i_isolate->factory()->NewStringFromAsciiChecked(updated_source), false,
+      &result);
+  CHECK_EQ(result.status, debug::LiveEditResult::OK);
+
+  // The unchanged function keeps its SharedFunctionInfo and stays lazy.
+  CHECK_EQ(foo->shared(), *foo_shared);
+  CHECK(!foo_shared->is_compiled());
+
+  // Only the changed function got bytecode when the updated script was
+  // compiled. In particular {inner}, which had no SharedFunctionInfo in the
+  // old script, was not compiled.
+  i::Handle<i::Script> new_script(i::Script::cast(foo_shared->script()),
+                                  i_isolate);
+  CHECK_NE(*new_script, *i_script);
+  int compiled_functions = 0;
+  i::SharedFunctionInfo::ScriptIterator it(i_isolate, *new_script);
+  for (i::SharedFunctionInfo sfi = it.Next(); !sfi.is_null(); sfi = it.Next()) {
+    if (sfi.is_toplevel() || !sfi.is_compiled()) continue;
+    CHECK(sfi.Name().IsOneByteEqualTo(base::CStrVector("bar")));
+    compiled_functions++;
+  }
+  CHECK_EQ(1, compiled_functions);
+
+  // The lazy functions are compiled from their new positions in the updated
+  // source on first call.
+  CHECK_EQ(CompileRunChecked(isolate, "foo()")
+               ->ToInt32(context)
+               .ToLocalChecked()
+               ->Value(),
+           1);
+  CHECK_EQ(CompileRunChecked(isolate, "outer()()")
+               ->ToInt32(context)
+               .ToLocalChecked()
+               ->Value(),
+           3);
+  CHECK_EQ(CompileRunChecked(isolate, "bar()")
+               ->ToInt32(context)
+               .ToLocalChecked()
+               ->Value(),
+           42);
+}
 }  // namespace internal
 }  // namespace v8
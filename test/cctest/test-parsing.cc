@@ -785,6 +785,41 @@ TEST(StandAlonePreParser) {
   }
 }
 
+TEST(ExternalSourceSymbolsAreNotCopied) {
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::Factory* factory = isolate->factory();
+  v8::HandleScope handles(CcTest::isolate());
+  LocalContext env;
+
+  const char* source = "var identifier = 'literal'; var escaped = 'a\\nb';";
+  size_t source_length = strlen(source);
+  i::Handle<i::String> source_string =
+      factory
+          ->NewExternalStringFromOneByte(
+              new ScriptResource(source, source_length))
+          .ToHandleChecked();
+  i::Handle<i::Script> script = factory->NewScript(source_string);
+  i::UnoptimizedCompileState compile_state(isolate);
+  i::UnoptimizedCompileFlags flags =
+      i::UnoptimizedCompileFlags::ForScriptCompile(isolate, *script);
+  i::ParseInfo info(isolate, flags, &compile_state);
+  CHECK(i::parsing::ParseProgram(&info, script, isolate,
+                                 i::parsing::ReportStatisticsMode::kYes));
+
+  auto references_source = [&](const char* string) {
+    const i::AstRawString* raw_string =
+        info.ast_value_factory()->GetOneByteString(string);
+    const char* data = reinterpret_cast<const char*>(raw_string->raw_data());
+    return data >= source && data + raw_string->byte_length() <=
+                                 source + source_length;
+  };
+  CHECK(references_source("identifier"));
+  CHECK(references_source("literal"));
+  CHECK(references_source("escaped"));
+  // Literals with escapes differ from their source and are copied.
+  CHECK(!references_source("a\nb"));
+}
+
 
 TEST(StandAlonePreParserNoNatives) {
   v8::V8::Initialize();
@@ -0,0 +1,17 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import {pad} from "util.js";
+
+function formatRow(name, value) {
+  return pad(name, 8) + "|" + String(value);
+}
+
+export function formatTable(records, summary) {
+  const rows = records.map(record => formatRow(record.name, record.value));
+  for (const key of Object.keys(summary)) {
+    rows.push(formatRow(key, summary[key]));
+  }
+  return rows.join("\n");
+}
@@ -0,0 +1,17 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import {assert} from "util.js";
+
+function parseRecord(line) {
+  const fields = line.split(",");
+  assert(fields.length == 2, "Expected two fields: " + line);
+  const value = Number(fields[1]);
+  assert(!Number.isNaN(value), "Expected a number: " + fields[1]);
+  return {name: fields[0], value};
+}
+
+export function parseRecords(input) {
+  return input.split("\n").filter(line => line.length > 0).map(parseRecord);
+}
@@ -0,0 +1,14 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import {parseRecords} from "parse.js";
+import {summarize} from "stats.js";
+import {formatTable} from "format.js";
+
+const input = "a,1\nb,2\nc,3\nd,4";
+
+export function run() {
+  const records = parseRecords(input);
+  return formatTable(records, summarize(records));
+}
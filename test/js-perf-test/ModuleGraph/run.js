@@ -0,0 +1,42 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+d8.file.execute('../base.js');
+
+new BenchmarkSuite('ModuleGraph', [100], [
+  new Benchmark('ModuleGraph', false, false, 0, ModuleGraph)
+]);
+
+// Loads root.js, which imports three modules that all import util.js. Each
+// realm has its own module map, so every run fetches and compiles the whole
+// graph again.
+function ModuleGraph() {
+  const realm = Realm.create();
+  Realm.shared = false;
+  Realm.eval(realm, `
+      import("root.js").then(m => { m.run(); Realm.shared = true; });
+      %PerformMicrotaskCheckpoint();`);
+  Realm.dispose(realm);
+  if (!Realm.shared) throw new Error(666);
+}
+
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-ModuleGraph(Score): ' + result);
+}
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
@@ -0,0 +1,17 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import {assert, sum} from "util.js";
+
+export function summarize(records) {
+  assert(records.length > 0, "Expected at least one record");
+  const values = records.map(record => record.value);
+  const total = sum(values);
+  return {
+    total,
+    mean: total / values.length,
+    min: Math.min(...values),
+    max: Math.max(...values)
+  };
+}
@@ -0,0 +1,18 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+export function assert(condition, message) {
+  if (!condition) throw new Error(message);
+}
+
+export function pad(string, width) {
+  while (string.length < width) string += " ";
+  return string;
+}
+
+export function sum(values) {
+  let result = 0;
+  for (const value of values) result += value;
+  return result;
+}
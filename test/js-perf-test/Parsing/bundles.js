@@ -0,0 +1,60 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("LicenseHeader", [1000], [
+  new Benchmark("LicenseHeader", false, true, iterations, Run, LicenseHeaderSetup)
+]);
+
+new BenchmarkSuite("LineComments", [1000], [
+  new Benchmark("LineComments", false, true, iterations, Run, LineCommentsSetup)
+]);
+
+new BenchmarkSuite("LongIdentifiers", [1000], [
+  new Benchmark("LongIdentifiers", false, true, iterations, Run, LongIdentifiersSetup)
+]);
+
+new BenchmarkSuite("MinifiedBundle", [1000], [
+  new Benchmark("MinifiedBundle", false, true, iterations, Run, MinifiedBundleSetup)
+]);
+
+const licenseLine =
+    " * Permission is hereby granted, free of charge, to any person " +
+    "obtaining a copy of this software and associated documentation files\n";
+
+function LicenseHeaderSetup() {
+  code = ("/**\n" + licenseLine.repeat(40) + " */\n").repeat(10);
+  %FlattenString(code);
+}
+
+function LineCommentsSetup() {
+  code = ("    // " + licenseLine).repeat(400);
+  %FlattenString(code);
+}
+
+function LongIdentifiersSetup() {
+  code = "";
+  for (let i = 0; i < 400; i++) {
+    code += "var someRatherLongDescriptiveIdentifierName" + i +
+        " = anotherRatherLongDescriptiveIdentifierName" + i + ";\n";
+  }
+  %FlattenString(code);
+}
+
+function MinifiedBundleSetup() {
+  let module = "function(e,t,n){\"use strict\";" +
+      "Object.defineProperty(t,\"__esModule\",{value:!0});" +
+      "var r=n(\"./node_modules/some-package/lib/index.js\")," +
+      "o=\"An error message that is long enough to be a realistic one\";" +
+      "t.default=function(e){return e&&e.isValid?r.format(e):o}}";
+  code = "/*! bundle v1.0.0 | MIT License */\n(function(){var m=[" +
+      (module + ",").repeat(200) + "];})";
+  %FlattenString(code);
+}
+
+function Run() {
+  if (code == undefined) {
+    throw new Error("No test data");
+  }
+  eval(code);
+}
@@ -0,0 +1,34 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("ManyDeclarations", [1000], [
+  new Benchmark("ManyDeclarations", false, true, iterations, Run, ManyDeclarationsSetup)
+]);
+
+new BenchmarkSuite("DeeplyNestedScopes", [1000], [
+  new Benchmark("DeeplyNestedScopes", false, true, iterations, Run, DeeplyNestedScopesSetup)
+]);
+
+function ManyDeclarationsSetup() {
+  code = "(function(){";
+  for (let i = 0; i < 2000; i++) {
+    code += "var v" + i + "=" + (i == 0 ? "0" : "v" + (i - 1)) + "+v0+v" +
+        (i >> 1) + ";";
+  }
+  code += "})()";
+  %FlattenString(code);
+}
+
+function DeeplyNestedScopesSetup() {
+  const depth = 100;
+  let uses = [];
+  for (let i = 0; i < depth; i++) uses.push("a" + i);
+  code = "(function(){";
+  for (let i = 0; i < depth; i++) {
+    code += "{let a" + i + "=" + i + ";";
+  }
+  for (let i = 0; i < 10; i++) code += "a0=" + uses.join("+") + ";";
+  code += "}".repeat(depth) + "})()";
+  %FlattenString(code);
+}
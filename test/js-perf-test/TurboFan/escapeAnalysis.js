@@ -0,0 +1,53 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Each of these allocates short-lived objects in a hot loop that escape
+// analysis can scalar replace. Run with --trace-gc or --trace-gc-nvp to
+// compare the allocation rate with --no-turbo-escape.
+
+function sumArguments() {
+  let sum = 0;
+  for (let i = 0; i < arguments.length; ++i) sum += arguments[i];
+  return sum;
+}
+
+function ArgumentsDynamicIndex() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) result += sumArguments(i, 1, 2, 3);
+  return result;
+}
+
+function* range(n) {
+  for (let i = 0; i < n; ++i) yield i;
+}
+
+function IteratorResult() {
+  let result = 0;
+  for (const i of range(1000)) result += i;
+  return result;
+}
+
+function SmallTuple() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) {
+    const [a, b] = [i, i + 1];
+    result += a * b;
+  }
+  return result;
+}
+
+function Closure() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) {
+    const add = (x) => x + i;
+    result = add(result);
+  }
+  return result;
+}
+
+createSuite('EscapeAnalysis-ArgumentsDynamicIndex', 1000,
+            ArgumentsDynamicIndex);
+createSuite('EscapeAnalysis-IteratorResult', 1000, IteratorResult);
+createSuite('EscapeAnalysis-SmallTuple', 1000, SmallTuple);
+createSuite('EscapeAnalysis-Closure', 1000, Closure);
@@ -0,0 +1,64 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+d8.file.execute('../base.js');
+
+new BenchmarkSuite('CompileNewFunctions', [100], [
+  new Benchmark('CompileNewFunctions', false, false, 0, CompileNewFunctions)
+]);
+
+new BenchmarkSuite('OptimizeNewFunctions', [100], [
+  new Benchmark('OptimizeNewFunctions', false, false, 0, OptimizeNewFunctions)
+]);
+
+const functionsPerRun = 20;
+let functionCount = 0;
+
+// Every function has a source that was not compiled before, so each call
+// parses and compiles it from scratch, creating and destroying the zones
+// those phases use.
+function NewFunction() {
+  return new Function('a', 'b', `
+      let result = ${functionCount++};
+      for (let i = 0; i < a; i++) {
+        result += (i * b) % 7;
+      }
+      return result;`);
+}
+
+function CompileNewFunctions() {
+  for (let i = 0; i < functionsPerRun; i++) {
+    NewFunction()(2, 3);
+  }
+}
+
+function OptimizeNewFunctions() {
+  for (let i = 0; i < functionsPerRun; i++) {
+    const f = NewFunction();
+    %PrepareFunctionForOptimization(f);
+    f(2, 3);
+    %OptimizeFunctionOnNextCall(f);
+    f(2, 3);
+  }
+}
+
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-ZoneChurn(Score): ' + result);
+}
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
@@ -0,0 +1,15 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MODULE
+//
+// Flags: --streaming-compile
+
+// The siblings are compiled concurrently on background threads. The syntax
+// error in one of them is reported once.
+
+import {a} from "modules-skip-1-streaming-compile-error.mjs";
+import {b} from "modules-skip-2-streaming-compile-error.mjs";
+import {c} from "modules-skip-3-streaming-compile-error.mjs";
+import {d} from "modules-skip-4-streaming-compile-error.mjs";
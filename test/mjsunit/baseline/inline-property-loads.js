@@ -0,0 +1,51 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --sparkplug --no-always-sparkplug
+// Flags: --sparkplug-inline-property-loads --no-opt
+
+function load(o) {
+  return o.x;
+}
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+// Warm up the IC to be monomorphic with an in-object field handler.
+%EnsureFeedbackVectorForFunction(load);
+const p = new Point(1, 2);
+assertEquals(1, load(p));
+assertEquals(1, load(p));
+%CompileBaseline(load);
+assertTrue(isBaseline(load));
+
+// Monomorphic hit.
+assertEquals(1, load(p));
+assertEquals(3, load(new Point(3, 4)));
+assertEquals(1.5, load(new Point(1.5, 0)));
+
+// Misses fall back to the IC builtin.
+assertEquals(undefined, load({}));
+assertEquals(5, load({x: 5}));
+assertEquals(undefined, load(1));
+assertEquals('s', load({__proto__: {x: 's'}}));
+assertThrows(() => load(undefined), TypeError);
+
+// Out-of-object properties and dictionary mode objects.
+const many = {};
+for (let i = 0; i < 100; i++) many['p' + i] = i;
+many.x = 'out';
+assertEquals('out', load(many));
+const dict = {x: 'dict', y: 1};
+delete dict.y;
+assertEquals('dict', load(dict));
+
+// Getters on the same map shape.
+assertEquals(42, load({get x() { return 42; }}));
+
+// Back to the original map once the IC is megamorphic.
+assertEquals(1, load(p));
+assertTrue(isBaseline(load));
@@ -0,0 +1,76 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --deopt-generalize-feedback
+
+// Polymorphic load site that keeps seeing new maps.
+(function() {
+  function load(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load({x: 1}));
+  assertEquals(2, load({x: 2, y: 0}));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(3, load({x: 3}));
+  assertOptimized(load);
+
+  // A new map fails the polymorphic map check...
+  assertEquals(4, load({x: 4, z: 0}));
+  assertUnoptimized(load);
+
+  // ...and the deoptimizer turns the site megamorphic, so that the next
+  // optimized code no longer checks maps for it.
+  %PrepareFunctionForOptimization(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(5, load({x: 5}));
+  assertOptimized(load);
+  assertEquals(6, load({x: 6, a: 0}));
+  assertEquals(7, load({x: 7, b: 0}));
+  assertOptimized(load);
+})();
+
+// Polymorphic store site that keeps seeing new maps.
+(function() {
+  function store(o, v) { o.x = v; return o; }
+
+  %PrepareFunctionForOptimization(store);
+  store({x: 0}, 1);
+  store({x: 0, y: 0}, 1);
+  %OptimizeFunctionOnNextCall(store);
+  assertEquals(2, store({x: 0}, 2).x);
+  assertOptimized(store);
+
+  assertEquals(3, store({x: 0, z: 0}, 3).x);
+  assertUnoptimized(store);
+
+  %PrepareFunctionForOptimization(store);
+  %OptimizeFunctionOnNextCall(store);
+  assertEquals(4, store({x: 0}, 4).x);
+  assertOptimized(store);
+  assertEquals(5, store({x: 0, a: 0}, 5).x);
+  assertEquals(6, store({x: 0, b: 0}, 6).x);
+  assertOptimized(store);
+})();
+
+// Monomorphic sites are left to the IC and stay specialized.
+(function() {
+  function load(o) { return o.x; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load({x: 1}));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load({x: 2}));
+  assertOptimized(load);
+
+  assertEquals(3, load({x: 3, y: 0}));
+  assertUnoptimized(load);
+
+  %PrepareFunctionForOptimization(load);
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(4, load({x: 4}));
+  assertOptimized(load);
+  assertEquals(5, load({x: 5, z: 0}));
+  assertUnoptimized(load);
+})();
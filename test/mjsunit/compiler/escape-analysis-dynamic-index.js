@@ -0,0 +1,64 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Loads with a dynamic index from small non-escaping arrays and arguments
+// objects are turned into selects.
+(function testArgumentsDynamicIndex() {
+  function g() {
+    let sum = 0;
+    for (let i = 0; i < arguments.length; ++i) sum += arguments[i];
+    return sum;
+  }
+  function f(a, b, c, d) {
+    return g(a, b, c, d);
+  }
+
+  %PrepareFunctionForOptimization(g);
+  %PrepareFunctionForOptimization(f);
+  assertEquals(10, f(1, 2, 3, 4));
+  assertEquals(10, f(1, 2, 3, 4));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(10, f(1, 2, 3, 4));
+  assertEquals(26, f(5, 6, 7, 8));
+  assertOptimized(f);
+})();
+
+(function testArrayLiteralDynamicIndex() {
+  function f(x, i) {
+    const a = [x, x + 1, x + 2];
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1, 0));
+  assertEquals(3, f(1, 2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f(1, 0));
+  assertEquals(2, f(1, 1));
+  assertEquals(3, f(1, 2));
+  assertOptimized(f);
+  // Out of bounds loads still deoptimize.
+  assertEquals(undefined, f(1, 3));
+})();
+
+(function testMaterializedObjectsInElements() {
+  function f(i, deopt) {
+    const o0 = {x: 0};
+    const o1 = {x: 1};
+    const o2 = {x: 2};
+    const a = [o0, o1, o2];
+    const result = a[i];
+    if (deopt) %DeoptimizeNow();
+    return result.x + a[0].x;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1, false));
+  assertEquals(2, f(2, false));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f(1, false));
+  assertEquals(2, f(2, true));
+})();
@@ -147,6 +147,34 @@ for (let i = 0; i < 100; i++) {
   ExpectFastCall(uint32_test, 6);
 })();
 
+(function () {
+  function uint8_test(should_fallback = false) {
+    let typed_array = new Uint8Array([1, 2, 3, 200]);
+    return fast_c_api.add_all_uint8_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(uint8_test, 206);
+})();
+
+(function () {
+  function int16_test(should_fallback = false) {
+    let typed_array = new Int16Array([-1000, 1, 2, 3]);
+    return fast_c_api.add_all_int16_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(int16_test, -994);
+})();
+
+// TypedArray with a different element type than expected.
+(function () {
+  function int8_as_uint8_test(should_fallback = false) {
+    let typed_array = new Int8Array([-1, 1, 2, 3]);
+    return fast_c_api.add_all_uint8_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectSlowCall(int8_as_uint8_test, 5);
+})();
+
 (function () {
   function detached_typed_array_test(should_fallback = false) {
     let typed_array = new Int32Array([-42, 1, 2, 3]);
@@ -0,0 +1,80 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises string support for fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --opt
+// --always-opt is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-opt
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+
+d8.file.execute('test/mjsunit/compiler/fast-api-helpers.js');
+
+const fast_c_api = new d8.test.FastCAPI();
+
+// ----------- sum_char_codes_<ENCODING> -----------
+// `sum_char_codes_one_byte` and `sum_char_codes_two_byte` have the following
+// signatures:
+// uint32_t sum_char_codes_one_byte(const FastOneByteString&)
+// uint32_t sum_char_codes_two_byte(const FastTwoByteString&)
+
+// Sequential one-byte string.
+(function () {
+  function one_byte_test() {
+    return fast_c_api.sum_char_codes_one_byte('abc\xff');
+  }
+  ExpectFastCall(one_byte_test, 97 + 98 + 99 + 255);
+})();
+
+// Sequential two-byte string.
+(function () {
+  function two_byte_test() {
+    return fast_c_api.sum_char_codes_two_byte('aሴ');
+  }
+  ExpectFastCall(two_byte_test, 97 + 0x1234);
+})();
+
+// Empty string.
+(function () {
+  function empty_string_test() {
+    return fast_c_api.sum_char_codes_one_byte('');
+  }
+  ExpectFastCall(empty_string_test, 0);
+})();
+
+// Strings with the wrong encoding take the slow path.
+(function () {
+  function two_byte_as_one_byte_test() {
+    return fast_c_api.sum_char_codes_one_byte('aሴ');
+  }
+  ExpectSlowCall(two_byte_as_one_byte_test, 97 + 0x1234);
+})();
+
+// Non-flat strings take the slow path.
+(function () {
+  const long_string = 'x'.repeat(20);
+  function cons_string_test() {
+    return fast_c_api.sum_char_codes_one_byte(long_string + long_string);
+  }
+  ExpectSlowCall(cons_string_test, 40 * 120);
+})();
+
+// Non-strings take the slow path.
+(function () {
+  function string_mismatch(arg) {
+    return fast_c_api.sum_char_codes_one_byte(arg);
+  }
+
+  %PrepareFunctionForOptimization(string_mismatch);
+  string_mismatch('a');
+  %OptimizeFunctionOnNextCall(string_mismatch);
+  string_mismatch('a');
+
+  assert_throws_and_optimized(string_mismatch, 42);
+  assert_throws_and_optimized(string_mismatch, {});
+  assert_throws_and_optimized(string_mismatch, Symbol());
+})();
@@ -0,0 +1,45 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-inlining-benefit-per-byte
+// Flags: --max-inlined-bytecode-size-cumulative=200
+
+// The cumulative budget only fits some of the candidates below. Ranking them
+// by frequency per bytecode byte must still produce correct code, regardless
+// of which call sites end up being inlined.
+
+function large(a, b) {
+  let r = 0;
+  for (let i = 0; i < a; i++) {
+    r += (i * b) % 7;
+    r ^= (i << 2) | (b >>> 1);
+    r -= (i & b) + (a | 3);
+    r = (r * 31) | 0;
+  }
+  return r;
+}
+
+function medium(a, b) {
+  let x = a + b;
+  x = (x * 17) | 0;
+  x ^= a << 3;
+  x += b >>> 2;
+  return x;
+}
+
+function caller(n, cold) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum = (sum + medium(i, sum)) | 0;
+  }
+  if (cold) sum = (sum + large(n, sum)) | 0;
+  return sum;
+}
+
+%PrepareFunctionForOptimization(caller);
+const expected = [caller(10, false), caller(10, true)];
+assertEquals(expected[0], caller(10, false));
+%OptimizeFunctionOnNextCall(caller);
+assertEquals(expected[0], caller(10, false));
+assertEquals(expected[1], caller(10, true));
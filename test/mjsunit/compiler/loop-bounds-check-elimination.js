@@ -0,0 +1,56 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --turbo-loop-bounds-check-elimination
+
+(function TestTypedArraySum() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+
+  const a = new Float64Array([1.5, 2.5, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(11, sum(a));
+  assertEquals(11, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(11, sum(a));
+  assertEquals(0, sum(new Float64Array(0)));
+  assertEquals(3, sum(new Float64Array([1, 2])));
+  // Loads within the loop bounds never deoptimize.
+  assertOptimized(sum);
+})();
+
+(function TestArrayShrinkingInLoop() {
+  function f(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      if (a[i] === 2) a.length = i;
+      s += a[i] === undefined ? 100 : a[i];
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f([1, 3, 5].slice(0, 1)));
+  assertEquals(9, f([1, 3, 5]));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(9, f([1, 3, 5]));
+  assertEquals(101, f([1, 2, 3]));
+})();
+
+(function TestOffsetIndex() {
+  function f(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i + 1] | 0;
+    return s;
+  }
+
+  const a = new Int32Array([1, 2, 3]);
+  %PrepareFunctionForOptimization(f);
+  assertEquals(5, f(a));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(5, f(a));
+})();
@@ -0,0 +1,57 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-opt --no-sparkplug
+
+// Test bytecodes followed by JumpIfTrue/JumpIfFalse, which the interpreter
+// executes together with the test.
+
+function compare(a, b) {
+  let result = '';
+  if (a == b) result += 'eq';
+  if (a === b) result += 'seq';
+  if (a < b) result += 'lt';
+  if (a > b) result += 'gt';
+  if (a <= b) result += 'le';
+  if (a >= b) result += 'ge';
+  return result;
+}
+
+assertEquals('eqseqlege', compare(1, 1));
+assertEquals('ltle', compare(1, 2));
+assertEquals('gtge', compare(2, 1));
+assertEquals('eqlege', compare(1, '1'));
+assertEquals('', compare(NaN, NaN));
+assertEquals('ltle', compare('a', 'b'));
+
+function tests(x) {
+  let result = 0;
+  if (x === null) result |= 1;
+  if (x === undefined) result |= 2;
+  if (x == null) result |= 4;
+  if (typeof x === 'number') result |= 8;
+  if (x instanceof Array) result |= 16;
+  if (x && 'length' in x) result |= 32;
+  return result;
+}
+
+assertEquals(1 | 4, tests(null));
+assertEquals(2 | 4, tests(undefined));
+assertEquals(8, tests(0));
+assertEquals(16 | 32, tests([]));
+assertEquals(32, tests({length: 1}));
+assertEquals(0, tests({}));
+
+function loop(n) {
+  let count = 0;
+  for (let i = 0; i < n; i++) {
+    if (i % 3 === 0) continue;
+    count++;
+  }
+  return count;
+}
+
+assertEquals(0, loop(0));
+assertEquals(6, loop(10));
+assertEquals(666, loop(1000));
@@ -0,0 +1,22 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --streaming-compile
+
+// The requested modules are compiled concurrently on background threads
+// before the module graph is linked.
+
+import {a, set_a} from "modules-skip-1.mjs";
+import {b, c, zzz} from "modules-skip-2.mjs";
+import * as ns from "modules-skip-4.mjs";
+import {a as f} from "modules-skip-5.mjs";
+
+assertEquals(1, a);
+assertEquals(1, b);
+assertEquals(1, c);
+assertEquals(999, zzz);
+assertEquals("ooo", f());
+set_a(2);
+assertEquals(2, b);
+assertEquals(2, ns.a);
@@ -0,0 +1,40 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks --no-use-external-strings
+
+// Parallel compile tasks for sources that live on the V8 heap compile an
+// off-heap copy of the function's source range.
+
+(function(a) {
+ assertEquals(a, "IIFE");
+})("IIFE");
+
+var outer_var = 42;
+
+function lazy_outer() {
+ return 42;
+}
+
+(function() {
+ assertEquals(outer_var, 42);
+ assertEquals(lazy_outer(), 42);
+})();
+
+var result = (function recursive(a=0) {
+ if (a == 1) {
+  return 42;
+ }
+ return recursive(1);
+})();
+assertEquals(result, 42);
+
+// Functions at the very end of a one-byte and a two-byte source.
+assertEquals(1, eval("(function() { return 1; })()"));
+assertEquals(" ", eval("(function() { return ' '; })()"));
+assertEquals("λ", eval("(function() { return 'λ'; })()"));
+
+(function() {
+  class foo {};
+});  // Don't call IIFE so that it is compiled during idle time
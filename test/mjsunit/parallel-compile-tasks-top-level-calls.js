@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-top-level-calls --use-external-strings
+
+function declared_before(a) {
+  return a + 1;
+}
+
+assertEquals(43, declared_before(42));
+
+// Function declarations are hoisted, so calls may precede them.
+assertEquals('hoisted', declared_after());
+
+function declared_after() {
+  return 'hoisted';
+}
+
+function uses_outer() {
+  return outer_var + declared_before(1);
+}
+var outer_var = 40;
+assertEquals(42, uses_outer());
+
+function* generator() {
+  yield 1;
+  yield 2;
+}
+var gen = generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+
+async function async_function() {
+  return 42;
+}
+async_function().then(value => assertEquals(42, value));
+
+// Calls from nested blocks still count as top-level calls.
+function called_in_block() {
+  return 'block';
+}
+if (true) {
+  assertEquals('block', called_in_block());
+}
+
+// Redeclarations call the last declaration.
+function redeclared() {
+  return 1;
+}
+function redeclared() {
+  return 2;
+}
+assertEquals(2, redeclared());
+
+// Functions that are only called from other functions are not posted, but
+// still work when compiled lazily.
+function only_called_from_function() {
+  return 'lazy';
+}
+(function() {
+  assertEquals('lazy', only_called_from_function());
+})();
+
+// Calls of names that are not function declarations are ignored.
+var not_declared = () => 'arrow';
+assertEquals('arrow', not_declared());
@@ -0,0 +1,46 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Scopes with many references to the same names resolve later references
+// from earlier results. Hole checks still depend on each reference.
+
+function repeat(expression, count) {
+  return new Array(count).fill(expression).join(" + ");
+}
+
+(function TemporalDeadZone() {
+  const body = "let sum = " + repeat("x", 20) + "; return sum;";
+  const before = new Function(body + " let x = 1;");
+  assertThrows(before, ReferenceError);
+  const after = new Function("let x = 1; " + body);
+  assertEquals(20, after());
+})();
+
+(function ClosureReferences() {
+  const f = new Function(
+      "let x = 2; return function() { return " + repeat("x", 30) + "; };");
+  assertEquals(60, f()());
+})();
+
+(function GlobalReferences() {
+  globalThis.manyReferencesGlobal = 3;
+  const f = new Function("return " + repeat("manyReferencesGlobal", 30) + ";");
+  assertEquals(90, f());
+  delete globalThis.manyReferencesGlobal;
+  assertThrows(f, ReferenceError);
+})();
+
+(function SloppyEval() {
+  const f = new Function(
+      "var y = 1; var a = " + repeat("y", 20) + "; eval('var y = 2');" +
+      "return a + " + repeat("y", 20) + ";");
+  assertEquals(60, f());
+})();
+
+(function WithScope() {
+  const f = new Function(
+      "var z = 1; with ({}) { " + repeat("z", 20) + "; z = 2; }" +
+      "return function() { return z; };");
+  assertEquals(2, f()());
+})();
@@ -15,6 +15,7 @@
 #include "src/heap/local-heap.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -64,6 +65,22 @@ class BlockingCompilationJob : public OptimizedCompilationJob {
   base::Semaphore semaphore_;
 };
 
+// Compiles {function}, gives it a feedback vector that records
+// {invocation_count} invocations and marks it as waiting for a concurrent
+// compilation job.
+Handle<JSFunction> PrepareQueuedFunction(Isolate* isolate,
+                                         Handle<JSFunction> function,
+                                         int invocation_count) {
+  IsCompiledScope is_compiled_scope;
+  CHECK(Compiler::Compile(isolate, function, Compiler::CLEAR_EXCEPTION,
+                          &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
+  function->feedback_vector().set_invocation_count(invocation_count,
+                                                   kRelaxedStore);
+  function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
+  return function;
+}
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -97,5 +114,106 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, HotterJobsGoFirst) {
+  FLAG_VALUE_SCOPE(concurrent_recompilation_prioritize, true);
+  Handle<JSFunction> cold = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function cold() {}; cold;"), 10);
+  Handle<JSFunction> hot = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function hot() {}; hot;"), 500);
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  base::TimeTicks now = base::TimeTicks::Now();
+  dispatcher.AddToInputQueue(cold_job, now);
+  dispatcher.AddToInputQueue(hot_job, now);
+
+  EXPECT_EQ(hot_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(cold_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(nullptr, dispatcher.NextInput(nullptr));
+  delete cold_job;
+  delete hot_job;
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherTest, AgeingLetsOlderJobsWin) {
+  FLAG_VALUE_SCOPE(concurrent_recompilation_prioritize, true);
+  FlagScope<double> ageing_rate(&FLAG_concurrent_recompilation_ageing_rate,
+                                1.0);
+  Handle<JSFunction> cold = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function cold() {}; cold;"), 10);
+  Handle<JSFunction> hot = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function hot() {}; hot;"), 500);
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+
+  // The cold job has waited for a second, which at one invocation per
+  // millisecond outweighs the hot job's lead of 490 invocations.
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  base::TimeTicks now = base::TimeTicks::Now();
+  dispatcher.AddToInputQueue(hot_job, now);
+  dispatcher.AddToInputQueue(cold_job,
+                             now - base::TimeDelta::FromMilliseconds(1000));
+
+  EXPECT_EQ(cold_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(hot_job, dispatcher.NextInput(nullptr));
+  delete cold_job;
+  delete hot_job;
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherTest, FifoWithoutPrioritization) {
+  FLAG_VALUE_SCOPE(concurrent_recompilation_prioritize, false);
+  Handle<JSFunction> cold = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function cold() {}; cold;"), 10);
+  Handle<JSFunction> hot = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function hot() {}; hot;"), 500);
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  base::TimeTicks now = base::TimeTicks::Now();
+  dispatcher.AddToInputQueue(cold_job, now);
+  dispatcher.AddToInputQueue(hot_job, now);
+
+  EXPECT_EQ(cold_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(hot_job, dispatcher.NextInput(nullptr));
+  delete cold_job;
+  delete hot_job;
+  dispatcher.Stop();
+}
+
+TEST_F(OptimizingCompileDispatcherTest, CancelObsoleteJobs) {
+  Handle<JSFunction> live = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function live() {}; live;"), 10);
+  Handle<JSFunction> obsolete = PrepareQueuedFunction(
+      i_isolate(), RunJS<JSFunction>("function obsolete() {}; obsolete;"), 10);
+  BlockingCompilationJob* live_job =
+      new BlockingCompilationJob(i_isolate(), live);
+  BlockingCompilationJob* obsolete_job =
+      new BlockingCompilationJob(i_isolate(), obsolete);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  base::TimeTicks now = base::TimeTicks::Now();
+  dispatcher.AddToInputQueue(live_job, now);
+  dispatcher.AddToInputQueue(obsolete_job, now);
+
+  // E.g. a deoptimization resets the marker, so nobody waits for the job.
+  obsolete->ClearOptimizationMarker();
+  EXPECT_EQ(1, dispatcher.CancelObsoleteJobs());
+  EXPECT_EQ(0, dispatcher.CancelObsoleteJobs());
+
+  EXPECT_EQ(live_job, dispatcher.NextInput(nullptr));
+  EXPECT_EQ(nullptr, dispatcher.NextInput(nullptr));
+  delete live_job;
+  dispatcher.Stop();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -7,6 +7,8 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -20,24 +22,27 @@ class BranchEliminationTest : public GraphTest {
  public:
   BranchEliminationTest()
       : machine_(zone(), MachineType::PointerRepresentation(),
-                 MachineOperatorBuilder::kNoFlags) {}
+                 MachineOperatorBuilder::kNoFlags),
+        simplified_(zone()) {}
 
   MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
 
-  void Reduce() {
+  void Reduce(BranchElimination::Phase phase = BranchElimination::kLATE) {
     JSOperatorBuilder javascript(zone());
     JSGraph jsgraph(isolate(), graph(), common(), &javascript, nullptr,
                     machine());
     GraphReducer graph_reducer(zone(), graph(), tick_counter(), broker(),
                                jsgraph.Dead());
     BranchElimination branch_condition_elimination(&graph_reducer, &jsgraph,
-                                                   zone(), nullptr);
+                                                   zone(), nullptr, phase);
     graph_reducer.AddReducer(&branch_condition_elimination);
     graph_reducer.ReduceGraph();
   }
 
  private:
   MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
 };
 
 TEST_F(BranchEliminationTest, NestedBranchSameTrue) {
@@ -205,6 +210,128 @@ TEST_F(BranchEliminationTest, BranchInsideLoopSame) {
   EXPECT_THAT(ret1, IsReturn(IsInt32Constant(2), effect, loop));
 }
 
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThan) {
+  FLAG_SCOPE(turbo_loop_bounds_check_elimination);
+  // { if (i < length) return a[i]; }
+  // should drop the bounds check on {i}.
+  Node* index = Parameter(Type::Range(0.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 100.0, zone()), 1);
+  Node* condition = graph()->NewNode(simplified()->NumberLessThan(), index,
+                                     length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(FeedbackSource()), index,
+                       length, graph()->start(), if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 99.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, check, check, if_true);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduce(BranchElimination::kEARLY);
+
+  EXPECT_THAT(ret->InputAt(1), IsTypeGuard(index, if_true));
+}
+
+TEST_F(BranchEliminationTest, CheckBoundsNotDominatedByLessThan) {
+  FLAG_SCOPE(turbo_loop_bounds_check_elimination);
+  // { if (!(i < length)) return a[i]; }
+  // must keep the bounds check on {i}.
+  Node* index = Parameter(Type::Range(0.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 100.0, zone()), 1);
+  Node* condition = graph()->NewNode(simplified()->NumberLessThan(), index,
+                                     length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(FeedbackSource()), index,
+                       length, graph()->start(), if_false);
+  NodeProperties::SetType(check, Type::Range(0.0, 99.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret =
+      graph()->NewNode(common()->Return(), zero, check, check, if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduce(BranchElimination::kEARLY);
+
+  EXPECT_EQ(check, ret->InputAt(1));
+}
+
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThanOrEqualFalse) {
+  FLAG_SCOPE(turbo_loop_bounds_check_elimination);
+  // { if (!(length <= i)) return a[i]; }
+  // should drop the bounds check on {i}.
+  Node* index = Parameter(Type::Range(0.0, 1000.0, zone()), 0);
+  Node* length = Parameter(Type::Range(0.0, 100.0, zone()), 1);
+  Node* condition = graph()->NewNode(simplified()->NumberLessThanOrEqual(),
+                                     length, index);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(FeedbackSource()), index,
+                       length, graph()->start(), if_false);
+  NodeProperties::SetType(check, Type::Range(0.0, 99.0, zone()));
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret =
+      graph()->NewNode(common()->Return(), zero, check, check, if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+  Reduce(BranchElimination::kEARLY);
+
+  EXPECT_THAT(ret->InputAt(1), IsTypeGuard(index, if_false));
+}
+
+TEST_F(BranchEliminationTest, CheckBoundsOnLoopInductionVariable) {
+  FLAG_SCOPE(turbo_loop_bounds_check_elimination);
+  // { for (let i = 0; i < length; i++) a[i]; return i; }
+  // should drop the bounds check on {i} inside the loop.
+  Node* length = Parameter(Type::Range(0.0, 100.0, zone()), 0);
+
+  Node* loop = graph()->NewNode(common()->Loop(1), graph()->start());
+  Node* effect =
+      graph()->NewNode(common()->EffectPhi(1), graph()->start(), loop);
+  Node* index = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 1), NumberConstant(0.0),
+      loop);
+  NodeProperties::SetType(index, Type::Range(0.0, 100.0, zone()));
+
+  Node* condition = graph()->NewNode(simplified()->NumberLessThan(), index,
+                                     length);
+  Node* branch = graph()->NewNode(common()->Branch(), condition, loop);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(FeedbackSource()), index,
+                       length, effect, if_true);
+  NodeProperties::SetType(check, Type::Range(0.0, 99.0, zone()));
+  Node* increment = graph()->NewNode(simplified()->NumberAdd(), check,
+                                     NumberConstant(1.0));
+
+  loop->AppendInput(zone(), if_true);
+  NodeProperties::ChangeOp(loop, common()->Loop(2));
+  effect->InsertInput(zone(), 1, check);
+  NodeProperties::ChangeOp(effect, common()->EffectPhi(2));
+  index->InsertInput(zone(), 1, increment);
+  NodeProperties::ChangeOp(index,
+                           common()->Phi(MachineRepresentation::kTagged, 2));
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret =
+      graph()->NewNode(common()->Return(), zero, index, effect, if_false);
+  Node* terminate = graph()->NewNode(common()->Terminate(), effect, loop);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret, terminate));
+
+  Reduce(BranchElimination::kEARLY);
+
+  // Both the value and the effect uses of the check now use the guard.
+  Matcher<Node*> guard = IsTypeGuard(index, if_true);
+  EXPECT_THAT(increment->InputAt(0), guard);
+  EXPECT_THAT(effect->InputAt(1), guard);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,93 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-heuristic.h"
+
+#include "test/common/flag-utils.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "testing/gmock-support.h"
+
+using testing::ElementsAre;
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class JSInliningHeuristicTest : public GraphTest {
+ public:
+  JSInliningHeuristicTest() : GraphTest(4) {}
+  ~JSInliningHeuristicTest() override = default;
+
+ protected:
+  struct CallSite {
+    Node* node;
+    CallFrequency frequency;
+    int total_size;
+  };
+
+  CallSite NewCallSite(CallFrequency frequency, int total_size) {
+    Node* node =
+        graph()->NewNode(common()->Parameter(next_parameter_++), start());
+    return {node, frequency, total_size};
+  }
+
+  // Returns the call sites in the order in which the heuristic considers
+  // them for inlining.
+  std::vector<Node*> Rank(std::initializer_list<CallSite> call_sites) {
+    JSInliningHeuristic::Candidates candidates(zone());
+    for (const CallSite& call_site : call_sites) {
+      JSInliningHeuristic::Candidate candidate;
+      candidate.num_functions = 1;
+      candidate.node = call_site.node;
+      candidate.frequency = call_site.frequency;
+      candidate.total_size = call_site.total_size;
+      if (candidate.frequency.IsKnown()) {
+        candidate.score = JSInliningHeuristic::ComputeScore(
+            candidate.frequency.value(), candidate.total_size);
+      }
+      candidates.insert(candidate);
+    }
+    std::vector<Node*> result;
+    for (const JSInliningHeuristic::Candidate& candidate : candidates) {
+      result.push_back(candidate.node);
+    }
+    return result;
+  }
+
+ private:
+  int next_parameter_ = 0;
+};
+
+TEST_F(JSInliningHeuristicTest, CandidatesOrderedByFrequency) {
+  FLAG_VALUE_SCOPE(turbo_inlining_benefit_per_byte, false);
+  CallSite big = NewCallSite(CallFrequency(10.0f), 400);
+  CallSite small = NewCallSite(CallFrequency(6.0f), 40);
+  CallSite unknown = NewCallSite(CallFrequency(), 10);
+
+  EXPECT_THAT(Rank({unknown, small, big}),
+              ElementsAre(big.node, small.node, unknown.node));
+}
+
+TEST_F(JSInliningHeuristicTest, CandidatesOrderedByBenefitPerByte) {
+  FLAG_VALUE_SCOPE(turbo_inlining_benefit_per_byte, true);
+  CallSite big = NewCallSite(CallFrequency(10.0f), 400);
+  CallSite small = NewCallSite(CallFrequency(6.0f), 40);
+  CallSite unknown = NewCallSite(CallFrequency(), 10);
+
+  // 6 calls for 40 bytes beat 10 calls for 400 bytes.
+  EXPECT_THAT(Rank({unknown, small, big}),
+              ElementsAre(small.node, big.node, unknown.node));
+}
+
+TEST_F(JSInliningHeuristicTest, EqualScoresOrderedByNodeId) {
+  FLAG_VALUE_SCOPE(turbo_inlining_benefit_per_byte, true);
+  CallSite first = NewCallSite(CallFrequency(2.0f), 20);
+  CallSite second = NewCallSite(CallFrequency(4.0f), 40);
+
+  EXPECT_THAT(Rank({first, second}), ElementsAre(second.node, first.node));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "src/codegen/assembler-inl.h"
+#include "src/codegen/tick-counter.h"
+#include "src/compiler/backend/register-allocator.h"
+#include "src/compiler/frame.h"
 #include "src/compiler/pipeline.h"
 #include "test/unittests/compiler/backend/instruction-sequence-unittest.h"
 
@@ -80,6 +83,134 @@ class RegisterAllocatorTest : public InstructionSequenceTest {
     WireBlocks();
     Pipeline::AllocateRegistersForTesting(config(), sequence(), false, true);
   }
+
+  // Runs the phases of the top tier register allocator that come before
+  // linear scan, and returns the resulting live ranges and bundles.
+  TopTierRegisterAllocationData* BuildLiveRanges(
+      RegisterAllocationFlags flags) {
+    WireBlocks();
+    TopTierRegisterAllocationData* data =
+        zone()->New<TopTierRegisterAllocationData>(
+            config(), zone(), zone()->New<Frame>(0), sequence(), flags,
+            &tick_counter_);
+    ConstraintBuilder constraint_builder(data);
+    constraint_builder.MeetRegisterConstraints();
+    constraint_builder.ResolvePhis();
+    LiveRangeBuilder(data, zone()).BuildLiveRanges();
+    BundleBuilder(data).BuildBundles();
+    if (flags & RegisterAllocationFlag::kLoopAwareAllocation) {
+      LoopRangeSplitter(data).SplitRangesAroundLoops();
+    }
+    return data;
+  }
+
+  LifetimePosition BlockStart(int rpo) {
+    return LifetimePosition::GapFromInstructionIndex(
+        sequence()
+            ->InstructionBlockAt(RpoNumber::FromInt(rpo))
+            ->first_instruction_index());
+  }
+
+  // Returns true if {range} was split into a child that covers exactly
+  // [start, end[ and has no uses.
+  bool HasUnusedChild(TopLevelLiveRange* range, LifetimePosition start,
+                      LifetimePosition end) {
+    for (LiveRange* child = range; child != nullptr; child = child->next()) {
+      if (child->Start() == start && child->End() == end) {
+        return child->first_pos() == nullptr;
+      }
+    }
+    return false;
+  }
+
+  // A loop that uses all registers, with a value that is live across the loop
+  // but unused inside of it. Returns that value.
+  VReg BuildValueLiveAcrossLoop() {
+    const int kNumRegs = 3;
+    SetNumRegs(kNumRegs, kNumRegs);
+
+    StartBlock();
+    auto live_across = Parameter();
+    auto i = DefineConstant();
+    EndBlock();
+
+    {
+      StartLoop(2);
+
+      // Loop header. All registers are in use, so {live_across} has to be
+      // spilled while the loop runs.
+      StartBlock();
+      auto phi = Phi(i, 2);
+      auto a = EmitOI(Reg());
+      auto b = EmitOI(Reg());
+      auto next = EmitOI(Same(), Reg(phi), Reg(a), Reg(b));
+      SetInput(phi, 1, next);
+      EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+      StartBlock();
+      EndBlock(Jump(-1));
+
+      EndLoop();
+    }
+
+    StartBlock();
+    Return(Reg(live_across));
+    EndBlock();
+    return live_across;
+  }
+
+  // An inner loop of same-as-input copies nested in an outer loop. Returns a
+  // value that is used by the outer loop but not by the inner loop.
+  VReg BuildNestedLoopsWithCopies() {
+    StartBlock();
+    auto outer_value = Parameter();
+    auto inner_value = Parameter();
+    auto i = DefineConstant();
+    EndBlock();
+
+    {
+      StartLoop(5);
+
+      // Outer loop header, uses {outer_value}.
+      StartBlock();
+      auto outer_phi = Phi(i, 2);
+      auto sum = EmitOI(Same(), Reg(outer_phi), Reg(outer_value));
+      SetInput(outer_phi, 1, sum);
+      EndBlock();
+
+      {
+        StartLoop(2);
+
+        // Inner loop header, {outer_value} is live but unused here.
+        StartBlock();
+        auto inner_phi = Phi(sum, 2);
+        auto copy = EmitOI(Same(), Reg(inner_phi), Use(inner_value));
+        SetInput(inner_phi, 1, copy);
+        EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+        StartBlock();
+        EndBlock(Jump(-1));
+
+        EndLoop();
+      }
+
+      StartBlock();
+      EndBlock(Branch(Reg(DefineConstant()), 2, 1));
+
+      StartBlock();
+      EndBlock(Jump(-4));
+
+      EndLoop();
+    }
+
+    StartBlock();
+    Return(Reg(outer_value));
+    EndBlock();
+    return outer_value;
+  }
+
+ private:
+  TickCounter tick_counter_;
 };
 
 TEST_F(RegisterAllocatorTest, CanAllocateThreeRegisters) {
@@ -693,6 +824,87 @@ TEST_F(RegisterAllocatorTest, ValidMultipleDeferredBlockSpills) {
             GetParallelMoveCount(start_of_b6, Instruction::START, sequence()));
 }
 
+TEST_F(RegisterAllocatorTest, LoopAwareValueLiveAcrossLoop) {
+  SaveFlags save_flags;
+  FLAG_turbo_loop_aware_regalloc = true;
+  BuildValueLiveAcrossLoop();
+  Allocate();
+}
+
+TEST_F(RegisterAllocatorTest, LoopAwareSplitsValueLiveAcrossLoop) {
+  VReg live_across = BuildValueLiveAcrossLoop();
+  TopTierRegisterAllocationData* data =
+      BuildLiveRanges(RegisterAllocationFlag::kLoopAwareAllocation);
+
+  // The loop covers blocks 1 and 2, and {live_across} is split at both of its
+  // boundaries. The remainder after the loop keeps the use in block 3.
+  TopLevelLiveRange* range = data->GetOrCreateLiveRangeFor(live_across.value_);
+  ASSERT_TRUE(HasUnusedChild(range, BlockStart(1), BlockStart(3)));
+  LiveRange* after_loop = range->next()->next();
+  ASSERT_NE(nullptr, after_loop);
+  EXPECT_EQ(BlockStart(3), after_loop->Start());
+  EXPECT_NE(nullptr, after_loop->first_pos());
+}
+
+TEST_F(RegisterAllocatorTest, ValueLiveAcrossLoopIsNotSplitByDefault) {
+  VReg live_across = BuildValueLiveAcrossLoop();
+  TopTierRegisterAllocationData* data = BuildLiveRanges({});
+
+  TopLevelLiveRange* range = data->GetOrCreateLiveRangeFor(live_across.value_);
+  EXPECT_EQ(nullptr, range->next());
+}
+
+TEST_F(RegisterAllocatorTest, LoopAwareNestedLoopsWithCopies) {
+  SaveFlags save_flags;
+  FLAG_turbo_loop_aware_regalloc = true;
+  BuildNestedLoopsWithCopies();
+  Allocate();
+}
+
+TEST_F(RegisterAllocatorTest, LoopAwareSplitsAroundInnerLoopOnly) {
+  VReg outer_value = BuildNestedLoopsWithCopies();
+  TopTierRegisterAllocationData* data =
+      BuildLiveRanges(RegisterAllocationFlag::kLoopAwareAllocation);
+
+  // {outer_value} is used in the outer loop header (block 1), so it is not
+  // split around the outer loop, only around the inner loop (blocks 2 and 3).
+  TopLevelLiveRange* range = data->GetOrCreateLiveRangeFor(outer_value.value_);
+  EXPECT_TRUE(HasUnusedChild(range, BlockStart(2), BlockStart(4)));
+  EXPECT_FALSE(HasUnusedChild(range, BlockStart(1), BlockStart(6)));
+}
+
+TEST_F(RegisterAllocatorTest, LoopAwareCoalescesSameAsInputCopy) {
+  StartBlock();
+  auto a = Parameter();
+  auto b = EmitOI(Same(), Reg(a));
+  Return(Reg(b));
+  EndBlock(Last());
+
+  TopTierRegisterAllocationData* data =
+      BuildLiveRanges(RegisterAllocationFlag::kLoopAwareAllocation);
+
+  // The gap move from {a} to {b} is coalesced, so both values get the same
+  // register hint and spill slot.
+  LiveRangeBundle* bundle =
+      data->GetOrCreateLiveRangeFor(a.value_)->get_bundle();
+  ASSERT_NE(nullptr, bundle);
+  EXPECT_EQ(bundle, data->GetOrCreateLiveRangeFor(b.value_)->get_bundle());
+}
+
+TEST_F(RegisterAllocatorTest, SameAsInputCopyIsNotCoalescedByDefault) {
+  StartBlock();
+  auto a = Parameter();
+  auto b = EmitOI(Same(), Reg(a));
+  Return(Reg(b));
+  EndBlock(Last());
+
+  TopTierRegisterAllocationData* data = BuildLiveRanges({});
+
+  // Without the loop-aware mode only phis are put into bundles.
+  EXPECT_EQ(nullptr, data->GetOrCreateLiveRangeFor(a.value_)->get_bundle());
+  EXPECT_EQ(nullptr, data->GetOrCreateLiveRangeFor(b.value_)->get_bundle());
+}
+
 namespace {
 
 enum class ParameterType { kFixedSlot, kSlot, kRegister, kFixedRegister };
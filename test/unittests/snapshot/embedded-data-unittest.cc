@@ -0,0 +1,154 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/embedded/embedded-data.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class EmbeddedDataTest : public TestWithIsolate {
+ protected:
+  static constexpr int kFirstBytecodeHandler =
+      static_cast<int>(Builtin::kFirstBytecodeHandler);
+
+  // A profile in which builtins are called a varying number of times, with
+  // many ties and the bytecode handlers being the hottest by far.
+  static std::vector<double> FakeExecutionCounts() {
+    std::vector<double> execution_counts(Builtins::kBuiltinCount);
+    for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+      execution_counts[i] = (i * 7919) % 101;
+      if (i >= kFirstBytecodeHandler) execution_counts[i] += 1000000;
+    }
+    return execution_counts;
+  }
+
+  // Creates an embedded blob without metadata whose code section contains
+  // builtins of varying sizes in the given order.
+  EmbeddedData CreateBlob(const std::vector<Builtin>& layout_order) {
+    std::vector<struct EmbeddedData::LayoutDescription> layout_descriptions(
+        EmbeddedData::kTableSize);
+    uint32_t code_size = 0;
+    for (Builtin builtin : layout_order) {
+      uint32_t instruction_size = 1 + (Builtins::ToInt(builtin) % 7) * 13;
+      struct EmbeddedData::LayoutDescription& desc =
+          layout_descriptions[Builtins::ToInt(builtin)];
+      desc.instruction_offset = code_size;
+      desc.instruction_length = instruction_size;
+      desc.metadata_offset = 0;
+      desc.metadata_length = 0;
+      code_size += EmbeddedData::PadAndAlignCode(instruction_size);
+    }
+
+    code_.assign(code_size, 0);
+    data_.assign(EmbeddedData::FixedDataSize(), 0);
+    std::memcpy(data_.data() + EmbeddedData::LayoutDescriptionTableOffset(),
+                layout_descriptions.data(),
+                EmbeddedData::LayoutDescriptionTableSize());
+    uint32_t* layout_table = reinterpret_cast<uint32_t*>(
+        data_.data() + EmbeddedData::BuiltinLayoutTableOffset());
+    for (size_t i = 0; i < layout_order.size(); i++) {
+      layout_table[i] = static_cast<uint32_t>(Builtins::ToInt(layout_order[i]));
+    }
+    return EmbeddedData(code_.data(), static_cast<uint32_t>(code_.size()),
+                        data_.data(), static_cast<uint32_t>(data_.size()));
+  }
+
+ private:
+  std::vector<uint8_t> code_;
+  std::vector<uint8_t> data_;
+};
+
+namespace {
+
+void CheckTryLookupCode(const EmbeddedData& d) {
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    Address last = start + d.PaddedInstructionSizeOfBuiltin(builtin) - 1;
+    EXPECT_EQ(builtin, d.TryLookupCode(start)) << Builtins::name(builtin);
+    EXPECT_EQ(builtin, d.TryLookupCode(last)) << Builtins::name(builtin);
+  }
+  Address code_end = reinterpret_cast<Address>(d.code()) + d.code_size();
+  EXPECT_EQ(Builtin::kNoBuiltinId, d.TryLookupCode(code_end));
+}
+
+}  // namespace
+
+TEST_F(EmbeddedDataTest, DefaultLayoutOrderIsIdOrder) {
+  std::vector<Builtin> order = EmbeddedData::BuiltinLayoutOrder({});
+  ASSERT_EQ(static_cast<size_t>(Builtins::kBuiltinCount), order.size());
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    EXPECT_EQ(Builtins::FromInt(i), order[i]);
+  }
+}
+
+TEST_F(EmbeddedDataTest, ProfiledLayoutOrder) {
+  std::vector<double> execution_counts = FakeExecutionCounts();
+  std::vector<Builtin> order =
+      EmbeddedData::BuiltinLayoutOrder(execution_counts);
+
+  // The order is a permutation of all builtins.
+  ASSERT_EQ(static_cast<size_t>(Builtins::kBuiltinCount), order.size());
+  std::vector<bool> seen(Builtins::kBuiltinCount, false);
+  for (Builtin builtin : order) {
+    ASSERT_TRUE(Builtins::IsBuiltinId(builtin));
+    EXPECT_FALSE(seen[Builtins::ToInt(builtin)]) << Builtins::name(builtin);
+    seen[Builtins::ToInt(builtin)] = true;
+  }
+
+  // The other builtins go from least to most frequently called, keeping ID
+  // order among equally hot builtins.
+  for (int i = 0; i < kFirstBytecodeHandler; i++) {
+    EXPECT_LT(Builtins::ToInt(order[i]), kFirstBytecodeHandler);
+    if (i == 0) continue;
+    double previous = execution_counts[Builtins::ToInt(order[i - 1])];
+    double current = execution_counts[Builtins::ToInt(order[i])];
+    EXPECT_LE(previous, current);
+    if (previous == current) {
+      EXPECT_LT(Builtins::ToInt(order[i - 1]), Builtins::ToInt(order[i]));
+    }
+  }
+
+  // The bytecode handlers are contiguous, last, and in ID order even though
+  // they are the hottest builtins.
+  for (int i = kFirstBytecodeHandler; i < Builtins::kBuiltinCount; i++) {
+    EXPECT_EQ(Builtins::FromInt(i), order[i]);
+  }
+}
+
+TEST_F(EmbeddedDataTest, TryLookupCodeInProfiledLayout) {
+  std::vector<Builtin> order =
+      EmbeddedData::BuiltinLayoutOrder(FakeExecutionCounts());
+  EmbeddedData d = CreateBlob(order);
+  for (int i = 0; i < Builtins::kBuiltinCount; i++) {
+    EXPECT_EQ(order[i], d.BuiltinAtLayoutPosition(i));
+  }
+  CheckTryLookupCode(d);
+
+  // The bytecode handlers form one contiguous range at the end of the code
+  // section.
+  for (int i = kFirstBytecodeHandler + 1; i < Builtins::kBuiltinCount; i++) {
+    Builtin previous = Builtins::FromInt(i - 1);
+    EXPECT_EQ(d.InstructionStartOfBuiltin(previous) +
+                  d.PaddedInstructionSizeOfBuiltin(previous),
+              d.InstructionStartOfBuiltin(Builtins::FromInt(i)));
+  }
+  Builtin last = Builtins::FromInt(Builtins::kBuiltinCount - 1);
+  EXPECT_EQ(reinterpret_cast<Address>(d.code()) + d.code_size(),
+            d.InstructionStartOfBuiltin(last) +
+                d.PaddedInstructionSizeOfBuiltin(last));
+}
+
+TEST_F(EmbeddedDataTest, TryLookupCodeInEmbeddedBlob) {
+  CheckTryLookupCode(EmbeddedData::FromBlob(i_isolate()));
+}
+
+}  // namespace internal
+}  // namespace v8
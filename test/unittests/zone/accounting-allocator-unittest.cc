@@ -0,0 +1,124 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/accounting-allocator.h"
+
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/zone/zone-segment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(AccountingAllocator, ReusesReturnedSegments) {
+  AccountingAllocator allocator;
+  Segment* segment = allocator.AllocateSegment(8 * KB, false);
+  ASSERT_NE(nullptr, segment);
+  EXPECT_EQ(size_t{8 * KB}, allocator.GetCurrentMemoryUsage());
+
+  allocator.ReturnSegment(segment, false);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(size_t{8 * KB}, allocator.GetPooledMemoryUsage());
+
+  EXPECT_EQ(segment, allocator.AllocateSegment(8 * KB, false));
+  EXPECT_EQ(size_t{8 * KB}, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+  allocator.ReturnSegment(segment, false);
+}
+
+TEST(AccountingAllocator, PoolsOnlyZoneSegmentSizes) {
+  AccountingAllocator allocator;
+  Segment* segment = allocator.AllocateSegment(32 * KB, false);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment, false);
+  EXPECT_EQ(size_t{32 * KB}, allocator.GetPooledMemoryUsage());
+
+  // Segments of other sizes keep their exact size and are not pooled.
+  for (size_t bytes : {size_t{9 * KB}, size_t{16 * KB + 64}, size_t{64 * KB}}) {
+    segment = allocator.AllocateSegment(bytes, false);
+    ASSERT_NE(nullptr, segment);
+    EXPECT_EQ(bytes, segment->total_size());
+    allocator.ReturnSegment(segment, false);
+  }
+  EXPECT_EQ(size_t{32 * KB}, allocator.GetPooledMemoryUsage());
+}
+
+namespace {
+
+class ReturnSegmentThread final : public base::Thread {
+ public:
+  ReturnSegmentThread(AccountingAllocator* allocator, Segment* segment)
+      : base::Thread(base::Thread::Options("ReturnSegmentThread")),
+        allocator_(allocator),
+        segment_(segment) {}
+
+  void Run() override { allocator_->ReturnSegment(segment_, false); }
+
+ private:
+  AccountingAllocator* allocator_;
+  Segment* segment_;
+};
+
+}  // namespace
+
+TEST(AccountingAllocator, ReusesSegmentsReturnedOnOtherThreads) {
+  AccountingAllocator allocator;
+  Segment* segment = allocator.AllocateSegment(8 * KB, false);
+  ASSERT_NE(nullptr, segment);
+  ReturnSegmentThread thread(&allocator, segment);
+  CHECK(thread.Start());
+  thread.Join();
+  EXPECT_EQ(size_t{8 * KB}, allocator.GetPooledMemoryUsage());
+
+  EXPECT_EQ(segment, allocator.AllocateSegment(8 * KB, false));
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+  allocator.ReturnSegment(segment, false);
+}
+
+TEST(AccountingAllocator, TrimReleasesUnusedSegments) {
+  AccountingAllocator allocator;
+  Segment* first = allocator.AllocateSegment(8 * KB, false);
+  Segment* second = allocator.AllocateSegment(8 * KB, false);
+  allocator.ReturnSegment(first, false);
+  allocator.ReturnSegment(second, false);
+  EXPECT_EQ(size_t{16 * KB}, allocator.GetPooledMemoryUsage());
+
+  // Both segments were added since the last trim, so they are kept.
+  allocator.TrimSegmentPool();
+  EXPECT_EQ(size_t{16 * KB}, allocator.GetPooledMemoryUsage());
+
+  // Only one segment is reused before the next trim.
+  Segment* reused = allocator.AllocateSegment(8 * KB, false);
+  allocator.ReturnSegment(reused, false);
+  allocator.TrimSegmentPool();
+  EXPECT_EQ(size_t{8 * KB}, allocator.GetPooledMemoryUsage());
+
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
+TEST(AccountingAllocator, PoolSizeIsLimited) {
+  size_t old_pool_size = FLAG_zone_segment_pool_size;
+  FLAG_zone_segment_pool_size = 8 * KB;
+  {
+    AccountingAllocator allocator;
+    Segment* first = allocator.AllocateSegment(8 * KB, false);
+    Segment* second = allocator.AllocateSegment(8 * KB, false);
+    allocator.ReturnSegment(first, false);
+    allocator.ReturnSegment(second, false);
+    EXPECT_EQ(size_t{8 * KB}, allocator.GetPooledMemoryUsage());
+  }
+  FLAG_zone_segment_pool_size = 0;
+  {
+    AccountingAllocator allocator;
+    Segment* segment = allocator.AllocateSegment(8 * KB, false);
+    allocator.ReturnSegment(segment, false);
+    EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+  }
+  FLAG_zone_segment_pool_size = old_pool_size;
+}
+
+}  // namespace internal
+}  // namespace v8